@@ -1,6 +1,7 @@
 #pragma once
 #include "Sequence.hpp"
 #include "DynamicArray.hpp"
+#include "ParallelOps.hpp"
 
 template<typename ElementType>
 class ArraySequence : public Sequence<ElementType>
@@ -114,6 +115,32 @@ public:
         return result;
     }
 
+    //       Append:   ReserveBack(count),
+    //   CommitBack(count).   ,   
+    ElementType* ReserveBack(int count)
+    {
+        if (count < 0)
+            throw std::invalid_argument("Negative block size");
+        return array.reserve_back(count);
+    }
+
+    void CommitBack(int count)
+    {
+        if (count < 0)
+            throw std::invalid_argument("Negative block size");
+        array.commit_back(count);
+    }
+
+    //  generator(0), ..., generator(count - 1),    :
+    //    ,    ,     ReserveBack
+    template<typename Generator>
+    void AppendN(int count, Generator generator)
+    {
+        if (count < 0)
+            throw std::invalid_argument("Negative block size");
+        array.append_n(count, generator);
+    }
+
     Sequence<ElementType>* Prepend(ElementType item) override
     {
         auto* result = (ArraySequence<ElementType> *) GetThis();
@@ -162,15 +189,38 @@ public:
     //    return result;
     //}
 
-    template<typename ResultType>
-    ResultType Reduce(ResultType(*reducer)(ResultType, ElementType), ResultType initial) const
+    //     ,      
+    template<typename ResultType, typename Reducer>
+    ResultType Reduce(Reducer reducer, ResultType initial) const
     {
+        const ElementType* data = array.get_data();
+        size_t size = array.get_size();
         ResultType accumulator = initial;
-        for (int i = 0; i < GetLength(); ++i)
-            accumulator = reducer(accumulator, Get(i));
+        for (size_t i = 0; i < size; ++i)
+            accumulator = reducer(accumulator, data[i]);
         return accumulator;
     }
 
+    //   (ParallelOps.hpp): op   , identity 
+    //   . threads <= 0    
+    template<typename Op>
+    ElementType ParallelReduce(Op op, ElementType identity, int threads = 0) const
+    {
+        return ::ParallelReduce(array.get_data(), array.get_size(), identity, op, threads);
+    }
+
+    ElementType ParallelSum(SumMode mode = SumMode::Plain, int threads = 0) const
+    {
+        return ::ParallelSum(array.get_data(), array.get_size(), mode, threads);
+    }
+
+    // out   GetLength() 
+    template<typename ResultType, typename Func>
+    void ParallelMap(Func func, ResultType* out, int threads = 0) const
+    {
+        ::ParallelMap(array.get_data(), array.get_size(), out, func, threads);
+    }
+
 protected:
 
 };
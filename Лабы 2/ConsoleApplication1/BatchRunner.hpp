@@ -0,0 +1,284 @@
+#pragma once
+#include "TuringMachine.hpp"
+#include "ParallelOps.hpp"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <exception>
+#include <algorithm>
+#include <cstdint>
+
+//    
+struct BatchEntry
+{
+    RunStatus status;
+    unsigned long long steps;
+    int state;
+    long long position; //     
+    int worker;         // ,     
+    size_t tapeOffset;
+    int tapeSize;
+};
+
+//   
+struct BatchProgress
+{
+    size_t done;
+    size_t total;
+    double seconds;
+
+    double machinesPerSecond() const
+    {
+        return seconds > 0 ? done / seconds : 0.0;
+    }
+};
+
+//           .
+//       :     
+//   BatchGrain ,  ,      
+//        (   , 
+//   ).          ; 
+//  ,         
+template<typename T>
+class BatchRunner
+{
+public:
+    static const size_t BatchGrain = 8;
+
+private:
+    struct Worker
+    {
+        std::mutex lock;
+        size_t next;          // [next, end)     
+        size_t end;
+        Tape<T> tape;
+        std::vector<T> cells; //      
+
+        explicit Worker(T blank) : next(0), end(0), tape(blank)
+        {
+        }
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    bool keepTapes;
+    std::vector<BatchEntry> entries;
+    std::function<void(const BatchProgress&)> onProgress;
+    double reportInterval;
+    BatchProgress progress;
+    std::atomic<size_t> done;
+    std::atomic<uint64_t> stealCount;
+
+    //      self; false,       
+    bool take(size_t self, size_t& first, size_t& last)
+    {
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> guard(workers[self]->lock);
+                Worker& own = *workers[self];
+                if (own.next < own.end)
+                {
+                    first = own.next;
+                    last = std::min(own.end, own.next + BatchGrain);
+                    own.next = last;
+                    return true;
+                }
+            }
+
+            size_t victim = self;
+            size_t most = 0;
+            for (size_t w = 0; w < workers.size(); ++w)
+            {
+                std::lock_guard<std::mutex> guard(workers[w]->lock);
+                if (w != self && workers[w]->end - workers[w]->next > most)
+                {
+                    most = workers[w]->end - workers[w]->next;
+                    victim = w;
+                }
+            }
+            if (victim == self)
+            {
+                return false;
+            }
+
+            size_t stolenFirst;
+            size_t stolenLast;
+            {
+                std::lock_guard<std::mutex> guard(workers[victim]->lock);
+                Worker& other = *workers[victim];
+                size_t remaining = other.end - other.next;
+                if (remaining == 0)
+                {
+                    continue;
+                }
+                stolenLast = other.end;
+                stolenFirst = other.end - (remaining + 1) / 2;
+                other.end = stolenFirst;
+            }
+            std::lock_guard<std::mutex> guard(workers[self]->lock);
+            workers[self]->next = stolenFirst;
+            workers[self]->end = stolenLast;
+            stealCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void runMachine(Worker& worker, size_t self, const TuringMachine<T>& machine, unsigned long long maxSteps, BatchEntry& entry)
+    {
+        worker.tape.clear();
+        RunResult result = machine.run(worker.tape, maxSteps);
+        entry.status = result.status;
+        entry.steps = result.steps;
+        entry.state = result.state;
+        entry.position = worker.tape.position();
+        entry.worker = (int)self;
+        entry.tapeOffset = worker.cells.size();
+        entry.tapeSize = 0;
+        if (keepTapes)
+        {
+            const T* cells = worker.tape.contents(entry.tapeSize);
+            worker.cells.insert(worker.cells.end(), cells, cells + entry.tapeSize);
+        }
+    }
+
+    BatchProgress snapshot(std::chrono::steady_clock::time_point start) const
+    {
+        BatchProgress current;
+        current.done = done.load(std::memory_order_relaxed);
+        current.total = entries.size();
+        current.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return current;
+    }
+
+public:
+    // threadCount <= 0    ; keepTapes = false      
+    explicit BatchRunner(T blank = T(), int threadCount = 0, bool keepFinalTapes = true)
+        : keepTapes(keepFinalTapes), reportInterval(1.0), progress(BatchProgress{ 0, 0, 0.0 }), done(0), stealCount(0)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = DefaultThreadCount();
+        }
+        for (int t = 0; t < threadCount; ++t)
+        {
+            workers.push_back(std::unique_ptr<Worker>(new Worker(blank)));
+        }
+    }
+
+    // callback    run      intervalSeconds   
+    void setProgressCallback(std::function<void(const BatchProgress&)> callback, double intervalSeconds = 1.0)
+    {
+        onProgress = std::move(callback);
+        reportInterval = intervalSeconds;
+    }
+
+    void run(const std::vector<TuringMachine<T>>& machines, unsigned long long maxSteps)
+    {
+        entries.assign(machines.size(), BatchEntry());
+        done.store(0);
+        stealCount.store(0);
+        size_t threads = workers.size();
+        for (size_t w = 0; w < threads; ++w)
+        {
+            workers[w]->next = machines.size() * w / threads;
+            workers[w]->end = machines.size() * (w + 1) / threads;
+            workers[w]->cells.clear();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::exception_ptr> errors(threads);
+        auto work = [&](size_t self)
+            {
+                try
+                {
+                    Worker& worker = *workers[self];
+                    double nextReport = reportInterval;
+                    size_t first;
+                    size_t last;
+                    while (take(self, first, last))
+                    {
+                        for (size_t i = first; i < last; ++i)
+                        {
+                            runMachine(worker, self, machines[i], maxSteps, entries[i]);
+                        }
+                        done.fetch_add(last - first, std::memory_order_relaxed);
+                        if (self == 0 && onProgress)
+                        {
+                            BatchProgress current = snapshot(start);
+                            if (current.seconds >= nextReport)
+                            {
+                                onProgress(current);
+                                nextReport = current.seconds + reportInterval;
+                            }
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    errors[self] = std::current_exception();
+                }
+            };
+        std::vector<std::thread> threadPool;
+        threadPool.reserve(threads - 1);
+        for (size_t t = 1; t < threads; ++t)
+        {
+            threadPool.emplace_back(work, t);
+        }
+        work(0);
+        for (size_t t = 0; t < threadPool.size(); ++t)
+        {
+            threadPool[t].join();
+        }
+        for (size_t t = 0; t < errors.size(); ++t)
+        {
+            if (errors[t])
+            {
+                std::rethrow_exception(errors[t]);
+            }
+        }
+
+        progress = snapshot(start);
+        if (onProgress)
+        {
+            onProgress(progress);
+        }
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    const BatchEntry& result(size_t index) const
+    {
+        return entries.at(index);
+    }
+
+    //    index ( ); ,    
+    const T* tape(size_t index, int& size) const
+    {
+        const BatchEntry& entry = entries.at(index);
+        size = entry.tapeSize;
+        return workers[entry.worker]->cells.data() + entry.tapeOffset;
+    }
+
+    //   :  ,   
+    BatchProgress lastProgress() const
+    {
+        return progress;
+    }
+
+    int threadCount() const
+    {
+        return (int)workers.size();
+    }
+
+    //          
+    uint64_t steals() const
+    {
+        return stealCount.load();
+    }
+};
@@ -0,0 +1,621 @@
+#pragma once
+#include "LazySequence.hpp"
+#include "TuringMachine.hpp"
+#include "MacroMachine.hpp"
+#include "BatchRunner.hpp"
+#include "SmartPointer.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <string>
+#include <cstdlib>
+#include <thread>
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <memory>
+#include <random>
+
+//   (: ConsoleApplication1 --bench [ ] [operators|reduce|busybeaver|macro|batch|pointers|rope|generation|arrays])
+class Benchmarks
+{
+private:
+    static int identity(int x)
+    {
+        return x;
+    }
+
+    static long long triple(int x)
+    {
+        return 3LL * x + 1;
+    }
+
+    static bool isOdd(long long x)
+    {
+        return (x & 1) != 0;
+    }
+
+    static long long add(long long acc, long long x)
+    {
+        return acc + x;
+    }
+
+public:
+    template <class Func>
+    static double measure_seconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    static void print_timing(const std::string& name, double seconds, long long count)
+    {
+        std::cout << "  " << std::left << std::setw(44) << name
+            << std::right << std::fixed << std::setprecision(3) << seconds << " s, "
+            << std::setprecision(1) << (seconds > 0 ? count / seconds / 1e6 : 0.0) << " M elements/s\n";
+    }
+
+    //  Map -> Where -> Reduce:     , 
+    //     (    ),  ,
+    //      
+    static void bench_operators(long long count)
+    {
+        int n = (int)count;
+        std::cout << "Map -> Where -> Reduce over " << n << " elements\n";
+
+        long long before = 0;
+        double seconds = measure_seconds([&]()
+            {
+                before = Generate(std::function<int(int)>(&identity)).Take(n)
+                    .Map(std::function<long long(int)>(&triple))
+                    .Where(std::function<bool(long long)>(&isOdd))
+                    .Reduce(std::function<long long(long long, long long)>(&add), 0LL);
+            });
+        print_timing("function pointers (indirect calls)", seconds, n);
+
+        long long after = 0;
+        seconds = measure_seconds([&]()
+            {
+                after = Generate([](int x) { return x; }).Take(n)
+                    .Map([](int x) { return 3LL * x + 1; })
+                    .Where([](long long x) { return (x & 1) != 0; })
+                    .Reduce([](long long acc, long long x) { return acc + x; }, 0LL);
+            });
+        print_timing("template callables (inlined)", seconds, n);
+
+        if (before != after)
+        {
+            std::cout << "  MISMATCH: " << before << " != " << after << "\n";
+        }
+        std::cout << "  checksum " << after << "\n\n";
+    }
+
+    //    count-1  :   (Append 
+    //    )         
+    static void bench_generation(long long count)
+    {
+        int n = (int)count;
+        std::cout << "Random access to element " << n - 1 << " of a generated sequence\n";
+        auto value = [](int i) { return (long long)i * i % 1000003; };
+
+        long long expected = value(n - 1);
+        double seconds = measure_seconds([&]()
+            {
+                LazySequence<long long> seq;
+                for (int i = 0; i < n; ++i)
+                {
+                    seq.Append(value(i));
+                }
+                expected ^= seq.Get(n - 1);
+            });
+        print_timing("per-element Append", seconds, n);
+
+        long long result = 0;
+        seconds = measure_seconds([&]()
+            {
+                LazySequence<long long> seq(std::function<long long(int)>(value), 0);
+                result ^= seq.Get(n - 1);
+            });
+        print_timing("element rule, one block", seconds, n);
+
+        std::function<void(int, long long*, int)> block = [value](int start, long long* out, int size)
+            {
+                for (int i = 0; i < size; ++i)
+                {
+                    out[i] = value(start + i);
+                }
+            };
+        seconds = measure_seconds([&]()
+            {
+                LazySequence<long long> seq(block, 0);
+                result ^= seq.Get(n - 1);
+            });
+        print_timing("block rule", seconds, n);
+
+        int threads = (int)std::max(1u, std::thread::hardware_concurrency());
+        seconds = measure_seconds([&]()
+            {
+                LazySequence<long long> seq(block, 0);
+                seq.SetGenerationThreads(threads);
+                result ^= seq.Get(n - 1);
+            });
+        print_timing("block rule, " + std::to_string(threads) + " threads", seconds, n);
+        std::cout << "  checksum " << (expected ^ result) << "\n\n";
+    }
+
+    //   :  (, , ), min  max
+    //  count  float  1, 2, 4, ...     .   
+    //  : Get(i)         
+    static void bench_reduce(long long count)
+    {
+        size_t n = (size_t)count;
+        std::cout << "Parallel reduce over " << n << " floats (" << n * sizeof(float) / (1 << 20) << " MB)\n";
+        MArraySequence<float> data;
+        float* out = data.ReserveBack((int)n);
+        double exact = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = (float)((i * 2654435761u) % 1000) / 1000.0f;
+            exact += out[i];
+        }
+        data.CommitBack((int)n);
+
+        float value = 0;
+        double seconds = measure_seconds([&]()
+            {
+                value = 0;
+                float (*addFloat)(float, float) = [](float a, float b) { return a + b; };
+                for (int i = 0; i < data.GetLength(); ++i)
+                {
+                    value = addFloat(value, data.Get(i));
+                }
+            });
+        print_timing("Get(i) + function pointer", seconds, count);
+        std::cout << "  " << std::left << std::setw(44) << "  relative error" << std::scientific << std::setprecision(2)
+            << std::abs(value - exact) / exact << std::fixed << "\n";
+
+        std::vector<int> threadCounts;
+        for (int t = 1; t < DefaultThreadCount(); t *= 2)
+        {
+            threadCounts.push_back(t);
+        }
+        threadCounts.push_back(DefaultThreadCount());
+
+        const SumMode modes[] = { SumMode::Plain, SumMode::Kahan, SumMode::Pairwise };
+        const char* modeNames[] = { "sum", "sum (Kahan)", "sum (pairwise)" };
+        for (size_t t = 0; t < threadCounts.size(); ++t)
+        {
+            int threads = threadCounts[t];
+            std::string suffix = ", " + std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+            for (int m = 0; m < 3; ++m)
+            {
+                seconds = measure_seconds([&]() { value = data.ParallelSum(modes[m], threads); });
+                print_timing(modeNames[m] + suffix, seconds, count);
+                std::cout << "  " << std::left << std::setw(44) << "  relative error" << std::scientific << std::setprecision(2)
+                    << std::abs(value - exact) / exact << std::fixed << "\n";
+            }
+            float low = 0;
+            float high = 0;
+            seconds = measure_seconds([&]()
+                {
+                    low = data.ParallelReduce([](float a, float b) { return a < b ? a : b; }, std::numeric_limits<float>::max(), threads);
+                });
+            print_timing("min" + suffix, seconds, count);
+            seconds = measure_seconds([&]()
+                {
+                    high = data.ParallelReduce([](float a, float b) { return a > b ? a : b; }, -std::numeric_limits<float>::max(), threads);
+                });
+            print_timing("max" + suffix, seconds, count);
+            if (low != 0.0f || high != 0.999f)
+            {
+                std::cout << "  MISMATCH: min " << low << ", max " << high << "\n";
+            }
+        }
+        std::cout << "\n";
+    }
+
+    //  busy beaver   :  BB(2)..BB(5)  
+    // BB(6),       (   )
+    static void bench_busy_beaver(long long maxSteps)
+    {
+        std::cout << "Busy beaver machines, step budget " << maxSteps << "\n";
+        struct Candidate
+        {
+            const char* name;
+            const char* machine;
+        };
+        const Candidate candidates[] = {
+            { "BB(2) champion", "1RB1LB_1LA1RZ" },
+            { "BB(3) champion", "1RB1RZ_1LB0RC_1LC1LA" },
+            { "BB(4) champion", "1RB1LB_1LA0LC_1RZ1LD_1RD0RA" },
+            { "BB(5) champion", "1RB1LC_1RC1RB_1RD0LE_1LA1LD_1RZ0LA" },
+            { "BB(6) candidate", "1RB0LD_1RC0RF_1LC1LA_0LE1RZ_1LF0RB_0RC0RE" }
+        };
+        for (const Candidate& candidate : candidates)
+        {
+            TuringMachine<char> machine(ParseStandardMachine(candidate.machine), "A");
+            Tape<char> tape('0');
+            RunResult result = { RunStatus::StepLimit, 0, 0 };
+            double seconds = measure_seconds([&]() { result = machine.run(tape, (unsigned long long)maxSteps); });
+
+            char* cells = nullptr;
+            int size = 0;
+            tape.getContents(cells, size);
+            int ones = (int)std::count(cells, cells + size, '1');
+            delete[] cells;
+
+            std::cout << "  " << std::left << std::setw(18) << candidate.name
+                << std::setw(11) << (result.status == RunStatus::Halted ? "halted" : "step limit")
+                << std::right << std::setw(13) << result.steps << " steps, "
+                << std::setw(6) << ones << " ones, "
+                << std::fixed << std::setprecision(3) << seconds << " s, "
+                << std::setprecision(1) << (seconds > 0 ? result.steps / seconds / 1e6 : 0.0) << " M steps/s\n";
+        }
+        std::cout << "\n";
+    }
+
+    //        (  ),
+    //     BB(6)    10000  ,  run
+    static void bench_macro(long long maxSteps)
+    {
+        std::cout << "Macro-step simulator, step budget " << maxSteps << "\n";
+        struct Candidate
+        {
+            const char* name;
+            const char* machine;
+        };
+        const Candidate candidates[] = {
+            { "BB(5) champion", "1RB1LC_1RC1RB_1RD0LE_1LA1LD_1RZ0LA" },
+            { "BB(6) candidate", "1RB0LD_1RC0RF_1LC1LA_0LE1RZ_1LF0RB_0RC0RE" }
+        };
+        const int blockSizes[] = { 1, 3, 6 };
+        for (const Candidate& candidate : candidates)
+        {
+            TuringMachine<char> machine(ParseStandardMachine(candidate.machine), "A");
+            Tape<char> tape('0');
+            RunResult plain = { RunStatus::StepLimit, 0, 0 };
+            double seconds = measure_seconds([&]() { plain = machine.run(tape, (unsigned long long)maxSteps); });
+            std::cout << "  " << candidate.name << ": " << plain.steps << " steps\n";
+            std::cout << "    " << std::left << std::setw(16) << "step by step" << std::right
+                << std::fixed << std::setprecision(3) << seconds << " s\n";
+
+            for (int blockSize : blockSizes)
+            {
+                MacroMachine<char> macro(machine, blockSize, '0');
+                MacroRunResult result = { RunStatus::StepLimit, 0, 0 };
+                seconds = measure_seconds([&]() { result = macro.run(UInt128((uint64_t)maxSteps)); });
+                bool same = result.status == plain.status && result.steps == UInt128(plain.steps)
+                    && result.state == plain.state && macro.position() == tape.position();
+                std::cout << "    " << std::left << std::setw(16) << ("block size " + std::to_string(blockSize)) << std::right
+                    << std::fixed << std::setprecision(3) << seconds << " s, "
+                    << macro.lastMacroSteps() << " macro steps, "
+                    << macro.cachedTransitions() << " cached transitions" << (same ? "" : ", MISMATCH") << "\n";
+            }
+        }
+
+        TuringMachine<char> machine(ParseStandardMachine(candidates[1].machine), "A");
+        MacroMachine<char> macro(machine, 3, '0');
+        UInt128 budget = UInt128((uint64_t)maxSteps) * 10000;
+        MacroRunResult result = { RunStatus::StepLimit, 0, 0 };
+        double seconds = measure_seconds([&]() { result = macro.run(budget); });
+        std::cout << "  " << candidates[1].name << ", block size 3: " << result.steps.toString() << " steps, "
+            << macro.countSymbol('1').toString() << " ones, " << macro.getRuns().size() << " runs, "
+            << std::fixed << std::setprecision(3) << seconds << " s\n\n";
+    }
+
+    //        :      
+    //      (,  )
+    static void bench_batch(unsigned long long maxSteps)
+    {
+        std::vector<TuringMachine<char>> machines;
+        for (const std::string& text : AllStandardMachines(2, 2))
+        {
+            machines.push_back(TuringMachine<char>(ParseStandardMachine(text), "A"));
+        }
+        std::cout << "Batch of " << machines.size() << " machines (2 states, 2 symbols), step budget " << maxSteps << "\n";
+
+        size_t halted = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (size_t i = 0; i < machines.size(); ++i)
+                {
+                    Tape<char> tape('0');
+                    halted += machines[i].run(tape, maxSteps).status == RunStatus::Halted;
+                }
+            });
+        std::cout << "  " << std::left << std::setw(30) << "new tape per machine" << std::right
+            << std::fixed << std::setprecision(3) << seconds << " s, "
+            << std::setprecision(0) << machines.size() / seconds << " machines/s\n";
+
+        std::vector<int> threadCounts = { 1 };
+        if (DefaultThreadCount() > 1)
+        {
+            threadCounts.push_back(DefaultThreadCount());
+        }
+        for (int threads : threadCounts)
+        {
+            BatchRunner<char> runner('0', threads);
+            runner.run(machines, maxSteps);
+            runner.run(machines, maxSteps);
+            BatchProgress progress = runner.lastProgress();
+            size_t batchHalted = 0;
+            unsigned long long longest = 0;
+            for (size_t i = 0; i < runner.size(); ++i)
+            {
+                if (runner.result(i).status == RunStatus::Halted)
+                {
+                    ++batchHalted;
+                    longest = std::max(longest, runner.result(i).steps);
+                }
+            }
+            std::cout << "  " << std::left << std::setw(30) << ("batch runner, " + std::to_string(threads) + " threads") << std::right
+                << std::fixed << std::setprecision(3) << progress.seconds << " s, "
+                << std::setprecision(0) << progress.machinesPerSecond() << " machines/s, "
+                << runner.steals() << " steals, " << batchHalted << " halted, longest " << longest << " steps"
+                << (batchHalted == halted ? "" : ", MISMATCH") << "\n";
+        }
+        std::cout << "\n";
+    }
+
+    //   :   (  )   
+    template <class Pointer, class Make>
+    static void time_create(const std::string& name, long long count, Make make)
+    {
+        long long sum = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (long long i = 0; i < count; ++i)
+                {
+                    Pointer pointer = make((int)i);
+                    sum += *pointer;
+                }
+            });
+        print_timing(name + (sum == count * (count - 1) / 2 ? "" : " MISMATCH"), seconds, count);
+    }
+
+    //    :      
+    template <class Pointer>
+    static void time_copy(const std::string& name, long long count, const Pointer& original)
+    {
+        std::vector<Pointer> copies(64);
+        double seconds = measure_seconds([&]()
+            {
+                for (long long i = 0; i < count; ++i)
+                {
+                    copies[i & 63] = original;
+                }
+            });
+        copies.clear();
+        print_timing(name + (original.use_count() == 1 ? "" : " MISMATCH"), seconds, count);
+    }
+
+    //      IntrusivePtr
+    struct CountedInt : public RefCounted<>
+    {
+        int value;
+
+        CountedInt(int v) : value(v) {}
+
+        operator int() const
+        {
+            return value;
+        }
+    };
+
+    //         
+    template <class Weak>
+    static void time_lock(const std::string& name, long long count, const Weak& weak)
+    {
+        long long alive = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (long long i = 0; i < count; ++i)
+                {
+                    alive += weak.lock() ? 1 : 0;
+                }
+            });
+        print_timing(name + (alive == count ? "" : " MISMATCH"), seconds, count);
+    }
+
+    static void bench_pointers(long long count)
+    {
+        std::cout << "Smart pointers, " << count << " operations\n";
+        time_create<SmartPointer<int>>("create: SmartPointer(new T)", count, [](int i) { return SmartPointer<int>(new int(i)); });
+        time_create<SmartPointer<int>>("create: SmartPointer::make_single", count, [](int i) { return SmartPointer<int>::make_single(i); });
+        time_create<SmartPointer<int, PlainRefCount>>("create: make_single, plain count", count,
+            [](int i) { return SmartPointer<int, PlainRefCount>::make_single(i); });
+        time_create<std::shared_ptr<int>>("create: std::shared_ptr(new T)", count, [](int i) { return std::shared_ptr<int>(new int(i)); });
+        time_create<std::shared_ptr<int>>("create: std::make_shared", count, [](int i) { return std::make_shared<int>(i); });
+
+        time_create<IntrusivePtr<CountedInt>>("create: IntrusivePtr::make_single", count,
+            [](int i) { return IntrusivePtr<CountedInt>::make_single(i); });
+
+        time_copy("copy: SmartPointer, atomic count", count, SmartPointer<int>::make_single(1));
+        time_copy("copy: SmartPointer, plain count", count, SmartPointer<int, PlainRefCount>::make_single(1));
+        time_copy("copy: std::shared_ptr", count, std::make_shared<int>(1));
+        time_copy("copy: IntrusivePtr", count, IntrusivePtr<CountedInt>::make_single(1));
+
+        SmartPointer<int> owner = SmartPointer<int>::make_single(1);
+        std::shared_ptr<int> stdOwner = std::make_shared<int>(1);
+        time_lock("lock: WeakPointer", count, WeakPointer<int>(owner));
+        time_lock("lock: std::weak_ptr", count, std::weak_ptr<int>(stdOwner));
+        std::cout << "\n";
+    }
+
+    //   :  LazySequence   , 
+    //     O(log k) 
+    static void bench_rope(long long count)
+    {
+        const int length = (int)std::min<long long>(count, INT_MAX / 2);
+        const int inserts = 2000;
+        std::cout << "Inserts into a sequence of " << length << " elements\n";
+
+        std::mt19937 rng(1);
+        std::vector<int> positions(inserts);
+        for (int k = 0; k < inserts; ++k)
+        {
+            positions[k] = (int)(rng() % (unsigned)(length + k));
+        }
+
+        LazySequence<long long> flat([](int i) { return (long long)i; }, length);
+        double seconds = measure_seconds([&]()
+            {
+                for (int k = 0; k < inserts; ++k)
+                {
+                    flat.InsertAt(-1, positions[k]);
+                }
+            });
+        print_timing("LazySequence::InsertAt", seconds, inserts);
+
+        MixedLazySequence<long long> rope([](int i) { return (long long)i; }, length);
+        seconds = measure_seconds([&]()
+            {
+                for (int k = 0; k < inserts; ++k)
+                {
+                    rope.InsertAt(-1, positions[k]);
+                }
+            });
+        print_timing("MixedLazySequence::InsertAt", seconds, inserts);
+
+        long long sum = 0;
+        const int reads = 1000000;
+        seconds = measure_seconds([&]()
+            {
+                for (int k = 0; k < reads; ++k)
+                {
+                    sum += rope.Get((int)(rng() % (unsigned)(length + inserts)));
+                }
+            });
+        print_timing("MixedLazySequence::Get, " + std::to_string(rope.GetSegmentCount()) + " segments", seconds, reads);
+        bool same = rope.GetLength() == flat.GetLength();
+        for (int k = 0; k < length + inserts; k += 997)
+        {
+            same = same && flat.Get(k) == rope.Get(k);
+        }
+        std::cout << "  " << (same ? "" : "MISMATCH, ") << "depth " << rope.GetDepth() << "\n\n";
+    }
+
+    // ,     :      
+    struct HeavyElement
+    {
+        std::string text;
+
+        HeavyElement() : text(48, 'x') {}
+        HeavyElement(int i) : text(48, (char)('a' + i % 26)) {}
+    };
+
+    template <class Array, class Make>
+    static void time_push_back(const std::string& name, long long count, Make make)
+    {
+        size_t size = 0;
+        double seconds = measure_seconds([&]()
+            {
+                Array array;
+                for (long long i = 0; i < count; ++i)
+                {
+                    array.push_back(make((int)i));
+                }
+                size = array.size();
+            });
+        print_timing(name + (size == (size_t)count ? "" : " MISMATCH"), seconds, count);
+    }
+
+    //   DynamicArray   size(),   std::vector,   
+    template <class T>
+    struct DynamicArrayAdapter : public DynamicArray<T>
+    {
+        size_t size() const
+        {
+            return this->get_size();
+        }
+    };
+
+    //   push_back,        
+    static void bench_arrays(long long count)
+    {
+        std::cout << "Dynamic arrays, " << count << " push_back\n";
+        time_push_back<DynamicArrayAdapter<int>>("push_back int: DynamicArray", count, [](int i) { return i; });
+        time_push_back<std::vector<int>>("push_back int: std::vector", count, [](int i) { return i; });
+        long long strings = std::max(1LL, count / 10);
+        time_push_back<DynamicArrayAdapter<std::string>>("push_back string: DynamicArray", strings, [](int i) { return std::string(24, (char)('a' + i % 26)); });
+        time_push_back<std::vector<std::string>>("push_back string: std::vector", strings, [](int i) { return std::string(24, (char)('a' + i % 26)); });
+        time_push_back<DynamicArrayAdapter<HeavyElement>>("push_back heavy: DynamicArray", strings, [](int i) { return HeavyElement(i); });
+        time_push_back<std::vector<HeavyElement>>("push_back heavy: std::vector", strings, [](int i) { return HeavyElement(i); });
+
+        const int reserved = (int)std::min<long long>(strings, INT_MAX);
+        size_t capacity = 0;
+        double seconds = measure_seconds([&]()
+            {
+                DynamicArray<HeavyElement> array(reserved);
+                array.push_back(HeavyElement(1));
+                capacity = array.get_capacity();
+            });
+        print_timing("reserve heavy: DynamicArray(capacity)" + std::string(capacity == (size_t)reserved ? "" : " MISMATCH"), seconds, reserved);
+
+        const int inserts = (int)std::min<long long>(std::max(1LL, count / 1000), 100000);
+        long long checksum = 0;
+        seconds = measure_seconds([&]()
+            {
+                DynamicArray<int> array;
+                for (int i = 0; i < inserts; ++i)
+                {
+                    array.insert(i, 0);
+                }
+                checksum = array.get(0) + array.get(inserts - 1);
+            });
+        print_timing("insert at front int: DynamicArray" + std::string(checksum == inserts - 1 ? "" : " MISMATCH"), seconds, inserts);
+        std::cout << "\n";
+    }
+
+    static int run(int argc, char* argv[])
+    {
+        long long count = 100000000LL;
+        if (argc > 2)
+        {
+            count = std::atoll(argv[2]);
+        }
+        std::string only = argc > 3 ? argv[3] : "";
+
+        if (only.empty() || only == "operators")
+        {
+            bench_operators(count);
+        }
+        if (only.empty() || only == "reduce")
+        {
+            bench_reduce(count);
+        }
+        if (only.empty() || only == "busybeaver")
+        {
+            bench_busy_beaver(count);
+        }
+        if (only.empty() || only == "macro")
+        {
+            bench_macro(count);
+        }
+        if (only.empty() || only == "batch")
+        {
+            bench_batch((unsigned long long)std::max(1LL, count / 10000));
+        }
+        if (only.empty() || only == "pointers")
+        {
+            bench_pointers(std::max(1LL, count / 10));
+        }
+        if (only.empty() || only == "rope")
+        {
+            bench_rope(std::max(1LL, count / 100));
+        }
+        if (only.empty() || only == "generation")
+        {
+            bench_generation(std::max(1LL, count / 10));
+        }
+        if (only.empty() || only == "arrays")
+        {
+            bench_arrays(std::max(1LL, count / 10));
+        }
+        return 0;
+    }
+};
@@ -3,16 +3,25 @@
 #include "CardinalTests.hpp"
 #include "SmartPointerTests.hpp"
 #include "TapeTests.hpp"
+#include "TuringMachineTests.hpp"
+#include "Benchmarks.hpp"
 #include <iostream>  
+#include <string>
 
 using namespace std;
 
-int main()
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && string(argv[1]) == "--bench")
+    {
+        return Benchmarks::run(argc, argv);
+    }
+
     CardinalTests::test_all();
     LazySequenceTests::test_all();
     SmartPointerTests::test_all();
     TapeTests::test_all();
+    TuringMachineTests::test_all();
 
     cout << " ALL TESTS PASSED! " << endl;
     return 0;
@@ -0,0 +1,410 @@
+﻿#pragma once
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <stdexcept>
+#include <cstddef>
+#include <functional>
+#include "SmartPointer.hpp"
+
+template <class T>
+class LazySequence;
+
+// Пустой ли вызываемый объект: проверить можно только указатель на функцию и std::function
+template <class Func>
+bool IsNullCallable(const Func&)
+{
+    return false;
+}
+
+template <class R, class... Args>
+bool IsNullCallable(R(*func)(Args...))
+{
+    return func == nullptr;
+}
+
+template <class R, class... Args>
+bool IsNullCallable(const std::function<R(Args...)>& func)
+{
+    return !func;
+}
+
+// Тип элементов Map: заданный явно T2 либо тип, который возвращает func для элемента T
+template <class T2, class Func, class T>
+struct MapResult
+{
+    typedef T2 type;
+};
+
+template <class Func, class T>
+struct MapResult<void, Func, T>
+{
+    typedef typename std::decay<decltype(std::declval<Func&>()(std::declval<T&>()))>::type type;
+};
+
+// Ленивый конвейер: каждый оператор — маленький узел, который по запросу вытягивает
+// следующий элемент из родителя через Next(out). Узлы — шаблоны с конкретными типами
+// родителя и функции, поэтому цепочка Map→Where→... компилируется в один цикл без
+// виртуальных вызовов и промежуточных массивов. Ничего не вычисляется до Reduce/Get/обхода.
+
+// Источник: элементы LazySequence по порядку. Элементы, которых ещё нет в кэше
+// последовательности с правилом, вычисляются без записи в кэш. Источник либо смотрит на
+// чужую последовательность (Pipe(): она должна жить, пока им пользуются), либо вместе со
+// всеми своими копиями владеет общей последовательностью через owner
+template <class T>
+class SequenceSource
+{
+private:
+    SmartPointer<LazySequence<T>> owner;
+    LazySequence<T>* seq;
+    int position;
+
+public:
+    typedef T value_type;
+
+    explicit SequenceSource(LazySequence<T>* sequence) : owner(), seq(sequence), position(0)
+    {
+    }
+
+    explicit SequenceSource(const SmartPointer<LazySequence<T>>& shared) : owner(shared), seq(shared.get()), position(0)
+    {
+    }
+
+    bool Next(T& out)
+    {
+        return seq->Peek(position++, out);
+    }
+};
+
+// Источник без хранилища: rule(0), rule(1), ... Правило встраивается в цикл конвейера,
+// поэтому Generate(rule).Take(n) — самый дешёвый способ пройти по вычисляемым значениям
+template <class Rule>
+class GeneratorSource
+{
+private:
+    Rule rule;
+    int position;
+
+public:
+    typedef typename std::decay<decltype(std::declval<Rule&>()(0))>::type value_type;
+
+    explicit GeneratorSource(Rule r) : rule(std::move(r)), position(0)
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        out = rule(position++);
+        return true;
+    }
+};
+
+template <class Parent, class Func>
+class MapStage
+{
+private:
+    Parent parent;
+    Func func;
+
+public:
+    typedef typename Parent::value_type source_type;
+    typedef typename std::decay<decltype(std::declval<Func&>()(std::declval<source_type&>()))>::type value_type;
+
+    MapStage(Parent p, Func f) : parent(std::move(p)), func(std::move(f))
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        source_type item;
+        if (!parent.Next(item))
+        {
+            return false;
+        }
+        out = func(item);
+        return true;
+    }
+};
+
+template <class Parent, class Predicate>
+class WhereStage
+{
+private:
+    Parent parent;
+    Predicate predicate;
+
+public:
+    typedef typename Parent::value_type value_type;
+
+    WhereStage(Parent p, Predicate pred) : parent(std::move(p)), predicate(std::move(pred))
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        while (parent.Next(out))
+        {
+            if (predicate(out))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Попарное объединение; заканчивается вместе с более короткой стороной
+template <class Left, class Right, class Zipper>
+class ZipStage
+{
+private:
+    Left left;
+    Right right;
+    Zipper zipper;
+
+public:
+    typedef typename Left::value_type left_type;
+    typedef typename Right::value_type right_type;
+    typedef typename std::decay<decltype(std::declval<Zipper&>()(std::declval<left_type&>(), std::declval<right_type&>()))>::type value_type;
+
+    ZipStage(Left l, Right r, Zipper z) : left(std::move(l)), right(std::move(r)), zipper(std::move(z))
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        left_type a;
+        right_type b;
+        if (!left.Next(a) || !right.Next(b))
+        {
+            return false;
+        }
+        out = zipper(a, b);
+        return true;
+    }
+};
+
+template <class First, class Second>
+class ConcatStage
+{
+private:
+    First first;
+    Second second;
+    bool firstDone;
+
+public:
+    typedef typename First::value_type value_type;
+
+    ConcatStage(First f, Second s) : first(std::move(f)), second(std::move(s)), firstDone(false)
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        if (!firstDone)
+        {
+            if (first.Next(out))
+            {
+                return true;
+            }
+            firstDone = true;
+        }
+        return second.Next(out);
+    }
+};
+
+template <class Parent>
+class TakeStage
+{
+private:
+    Parent parent;
+    int left;
+
+public:
+    typedef typename Parent::value_type value_type;
+
+    TakeStage(Parent p, int count) : parent(std::move(p)), left(count)
+    {
+    }
+
+    bool Next(value_type& out)
+    {
+        if (left <= 0)
+        {
+            return false;
+        }
+        --left;
+        return parent.Next(out);
+    }
+};
+
+template <class Stage>
+class LazyPipeline
+{
+private:
+    Stage stage;
+
+public:
+    typedef typename Stage::value_type value_type;
+
+    explicit LazyPipeline(Stage s) : stage(std::move(s))
+    {
+    }
+
+    // Промежуточные операторы: только строят узел, ничего не вычисляют
+    template <class Func>
+    LazyPipeline<MapStage<Stage, Func>> Map(Func func) const
+    {
+        return LazyPipeline<MapStage<Stage, Func>>(MapStage<Stage, Func>(stage, std::move(func)));
+    }
+
+    template <class Predicate>
+    LazyPipeline<WhereStage<Stage, Predicate>> Where(Predicate predicate) const
+    {
+        return LazyPipeline<WhereStage<Stage, Predicate>>(WhereStage<Stage, Predicate>(stage, std::move(predicate)));
+    }
+
+    template <class Other, class Zipper>
+    LazyPipeline<ZipStage<Stage, Other, Zipper>> Zip(const LazyPipeline<Other>& other, Zipper zipper) const
+    {
+        return LazyPipeline<ZipStage<Stage, Other, Zipper>>(ZipStage<Stage, Other, Zipper>(stage, other.GetStage(), std::move(zipper)));
+    }
+
+    template <class Other>
+    LazyPipeline<ConcatStage<Stage, Other>> Concat(const LazyPipeline<Other>& other) const
+    {
+        return LazyPipeline<ConcatStage<Stage, Other>>(ConcatStage<Stage, Other>(stage, other.GetStage()));
+    }
+
+    LazyPipeline<TakeStage<Stage>> Take(int count) const
+    {
+        return LazyPipeline<TakeStage<Stage>>(TakeStage<Stage>(stage, count));
+    }
+
+    const Stage& GetStage() const
+    {
+        return stage;
+    }
+
+    // Вытягивание следующего элемента; конвейер при этом продвигается
+    bool Next(value_type& out)
+    {
+        return stage.Next(out);
+    }
+
+    // Завершающие операции: один проход по копии конвейера, O(1) дополнительной памяти
+    template <class T2, class Func>
+    T2 Reduce(Func func, T2 initial) const
+    {
+        Stage current(stage);
+        value_type item;
+        while (current.Next(item))
+        {
+            initial = func(initial, item);
+        }
+        return initial;
+    }
+
+    value_type Get(int index) const
+    {
+        if (index < 0)
+        {
+            throw std::out_of_range("Negative index");
+        }
+        Stage current(stage);
+        value_type item;
+        for (int i = 0; i <= index; ++i)
+        {
+            if (!current.Next(item))
+            {
+                throw std::out_of_range("Index out of range");
+            }
+        }
+        return item;
+    }
+
+    int Count() const
+    {
+        Stage current(stage);
+        value_type item;
+        int count = 0;
+        while (current.Next(item))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Однопроходный итератор для range-for
+    class iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename Stage::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef const value_type& reference;
+
+    private:
+        Stage* current;
+        value_type item;
+
+    public:
+
+        iterator() : current(nullptr), item()
+        {
+        }
+
+        explicit iterator(Stage* stage) : current(stage), item()
+        {
+            ++(*this);
+        }
+
+        const value_type& operator*() const
+        {
+            return item;
+        }
+
+        const value_type* operator->() const
+        {
+            return &item;
+        }
+
+        iterator& operator++()
+        {
+            if (current && !current->Next(item))
+            {
+                current = nullptr;
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return current == other.current;
+        }
+
+        bool operator!=(const iterator& other) const
+        {
+            return current != other.current;
+        }
+    };
+
+    // Обход продвигает сам конвейер: повторный обход продолжит с места остановки
+    iterator begin()
+    {
+        return iterator(&stage);
+    }
+
+    iterator end()
+    {
+        return iterator();
+    }
+};
+
+// Бесконечный конвейер по правилу
+template <class Rule>
+LazyPipeline<GeneratorSource<Rule>> Generate(Rule rule)
+{
+    return LazyPipeline<GeneratorSource<Rule>>(GeneratorSource<Rule>(std::move(rule)));
+}
@@ -1,81 +1,373 @@
 ﻿#pragma once
 #include "ASequence.hpp"
 #include "Cardinal.hpp"
+#include "SmartPointer.hpp"
 #include <stdexcept> 
 #include <algorithm>
 #include <utility>
 #include <functional>
+#include <climits>
+#include <vector>
+#include <type_traits>
+#include "LazyPipeline.hpp"
+
+// Что хранить из вычисленных по правилу элементов
+enum class CachePolicy
+{
+    KeepAll,       // все вычисленные элементы (по умолчанию)
+    SlidingWindow, // последние N элементов; более ранние вычисляются заново
+    LruBlocks,     // несколько блоков фиксированного размера, вытесняется давно не читанный
+    Recompute      // ничего: каждое чтение вычисляет элемент заново (для чистых правил)
+};
 
 template <class T>
 class LazySequence
 {
 private:
+    struct CacheBlock
+    {
+        int first;
+        std::vector<T> items;
+        unsigned long long lastUse;
+    };
+
+    // Состояние вытеснения для последовательности с правилом. При KeepAll и SlidingWindow
+    // кэш хранит элементы [base, base + длина кэша); при LruBlocks и Recompute кэш пуст,
+    // а base — граница уже вычислявшихся элементов
+    struct EvictionState
+    {
+        CachePolicy policy;
+        int size;       // длина окна или размер блока
+        int blockCount; // число хранимых блоков LRU
+        int base;
+        std::vector<CacheBlock> blocks;
+        unsigned long long clock;
+
+        EvictionState() : policy(CachePolicy::KeepAll), size(0), blockCount(0), base(0), clock(0)
+        {
+        }
+    };
+
     MArraySequence<T>* cash;
-    size_t ExCntr;
-    std::function<T(int)>* rule;
+    mutable size_t ExCntr;
+    // Правило в блочной форме: rule(start, out, count) пишет элементы start..start+count-1
+    // в out. Поэлементное правило оборачивается, так что вызов приходится на блок, а не на элемент
+    std::function<void(int, T*, int)> rule;
+    // Число потоков для вычисления по правилу; больше 1 — правило чистое и независимые
+    // блоки можно считать параллельно
+    int generationThreads;
+    // Ленивый источник производной последовательности (Map/Where/Zip/Concat): выдаёт
+    // следующий элемент или false в конце. Кэш пополняется из него только по запросу,
+    // поэтому поля меняются и из const-методов
+    mutable std::function<bool(T&)> source;
+    bool infinite;
+    EvictionState eviction;
+
+    // Дотягивает кэш из источника до count элементов; false, если источник кончился раньше
+    bool Pull(int count) const
+    {
+        while (source && cash->GetLength() < count)
+        {
+            T item;
+            if (!source(item))
+            {
+                source = nullptr;
+                return false;
+            }
+            cash->Append(item);
+            ExCntr++;
+        }
+        return cash->GetLength() >= count;
+    }
 
-public:
-    // Конструкторы
-    LazySequence() : cash(new MArraySequence<T>()), ExCntr(0), rule(nullptr)
+    // Блоки меньше этого считаются в одном потоке: запуск потока дороже
+    static const int ParallelBlock = 1 << 15;
+
+    // Элементы [start, start + count) по правилу; при generationThreads > 1 большой
+    // диапазон делится на непрерывные части по потокам
+    void GenerateRange(int start, T* out, int count) const
     {
+        int threads = std::min(generationThreads, count / ParallelBlock);
+        if (threads <= 1)
+        {
+            rule(start, out, count);
+            return;
+        }
+        ParallelRanges(count, threads, [&](size_t first, size_t last)
+            {
+                rule(start + (int)first, out + first, (int)(last - first));
+            });
     }
 
-    explicit LazySequence(T* items, int count) : cash(new MArraySequence<T>(items, count)), ExCntr(0), rule(nullptr)
+    // Вычисляет недостающие элементы до count одним блоком и дописывает их в кэш.
+    // Если правило бросило исключение, кэш не меняется
+    void Materialize(int count)
     {
+        int start = eviction.base + cash->GetLength();
+        if (count <= start)
+        {
+            return;
+        }
+        GenerateIntoCache(start, count - start, std::is_trivially_copyable<T>());
+        ExCntr += count - start;
     }
 
-    explicit LazySequence(MArraySequence<T>* seq) : cash(seq ? seq : new MArraySequence<T>()), ExCntr(cash ? cash->GetLength() : 0), rule(nullptr)
+    // Тривиально копируемые элементы правило пишет прямо в сырой хвост кэша
+    void GenerateIntoCache(int start, int count, std::true_type)
     {
+        T* out = cash->ReserveBack(count);
+        GenerateRange(start, out, count);
+        cash->CommitBack(count);
     }
 
-    explicit LazySequence(std::function<T(int)> genFunc, int k) : cash(new MArraySequence<T>()), ExCntr(0), rule(new std::function<T(int)>(std::move(genFunc)))
+    // Остальные правило заполняет присваиванием во временном блоке, откуда они переносятся в кэш
+    void GenerateIntoCache(int start, int count, std::false_type)
     {
-        if (!rule)
+        std::vector<T> block(count);
+        GenerateRange(start, block.data(), count);
+        cash->AppendN(count, [&](size_t i) { return std::move(block[i]); });
+    }
+
+    // Один элемент по правилу без записи в кэш
+    T Compute(int index) const
+    {
+        T value;
+        rule(index, &value, 1);
+        ExCntr++;
+        return value;
+    }
+
+    // Скользящее окно: вычисляет элементы до count, пропуская те, что сразу выпали бы из
+    // окна, и отбрасывает начало кэша, когда он вдвое длиннее окна (амортизированно O(1))
+    void Slide(int count)
+    {
+        int end = eviction.base + cash->GetLength();
+        if (count - eviction.size > end)
         {
-            throw std::invalid_argument("rule is empty");
+            *cash = MArraySequence<T>();
+            eviction.base = count - eviction.size;
         }
-        for (int i = 0; i < k; ++i)
+        Materialize(count);
+        if (cash->GetLength() > 2 * eviction.size)
         {
-            cash->Append((*rule)(i));
-            ExCntr++;
+            KeepLast(eviction.size);
         }
     }
 
-    LazySequence(const LazySequence& other) : cash(other.cash ? new MArraySequence<T>(*other.cash) : nullptr), ExCntr(other.ExCntr)
+    void KeepLast(int count)
     {
-        if (other.rule)
+        int drop = cash->GetLength() - count;
+        MArraySequence<T> kept;
+        kept.AppendN(count, [&](size_t i) { return cash->Get(drop + (int)i); });
+        *cash = std::move(kept);
+        eviction.base += drop;
+    }
+
+    // Блок LRU, содержащий index; отсутствующий вычисляется целиком на место давно не читанного
+    const CacheBlock& LruBlock(int index)
+    {
+        int first = index - index % eviction.size;
+        size_t victim = 0;
+        for (size_t b = 0; b < eviction.blocks.size(); ++b)
+        {
+            if (eviction.blocks[b].first == first)
+            {
+                eviction.blocks[b].lastUse = ++eviction.clock;
+                return eviction.blocks[b];
+            }
+            if (eviction.blocks[b].lastUse < eviction.blocks[victim].lastUse)
+            {
+                victim = b;
+            }
+        }
+        if ((int)eviction.blocks.size() < eviction.blockCount)
         {
-            rule = new std::function<T(int)>(*other.rule);
+            eviction.blocks.push_back(CacheBlock());
+            victim = eviction.blocks.size() - 1;
+            eviction.blocks[victim].items.resize(eviction.size);
         }
-        else
+
+        CacheBlock& block = eviction.blocks[victim];
+        block.first = -1;
+        block.lastUse = 0;
+        GenerateRange(first, block.items.data(), eviction.size);
+        ExCntr += eviction.size;
+        block.first = first;
+        block.lastUse = ++eviction.clock;
+        eviction.base = std::max(eviction.base, first + eviction.size);
+        return block;
+    }
+
+    // Уже вычисленный и не вытесненный элемент
+    bool FindCached(int index, T& out) const
+    {
+        if (index >= eviction.base && index < eviction.base + cash->GetLength())
+        {
+            out = cash->Get(index - eviction.base);
+            return true;
+        }
+        for (size_t b = 0; b < eviction.blocks.size(); ++b)
+        {
+            const CacheBlock& block = eviction.blocks[b];
+            if (block.first >= 0 && index >= block.first && index < block.first + eviction.size)
+            {
+                out = block.items[index - block.first];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Get для последовательности с правилом и вытеснением
+    T GetEvicting(int index)
+    {
+        switch (eviction.policy)
+        {
+        case CachePolicy::SlidingWindow:
+            if (index >= eviction.base + cash->GetLength())
+            {
+                Slide(index + 1);
+            }
+            if (index >= eviction.base)
+            {
+                return cash->Get(index - eviction.base);
+            }
+            return Compute(index);
+        case CachePolicy::LruBlocks:
+        {
+            const CacheBlock& block = LruBlock(index);
+            return block.items[index - block.first];
+        }
+        default:
+            eviction.base = std::max(eviction.base, index + 1);
+            return Compute(index);
+        }
+    }
+
+    // Параллельные операции работают по хранилищу кэша: конечный источник вычисляется целиком
+    void RequireMaterialized() const
+    {
+        if (!cash)
+        {
+            throw std::runtime_error("Accessing destroyed sequence");
+        }
+        RequireKeepAll();
+        Drain();
+    }
+
+    void RequireKeepAll() const
+    {
+        if (eviction.policy != CachePolicy::KeepAll)
+        {
+            throw std::logic_error("Sequence with cache eviction cannot be modified");
+        }
+    }
+
+    // Конечный источник вычисляется целиком (нужна длина или последний элемент)
+    void Drain() const
+    {
+        if (source && !infinite)
+        {
+            Pull(INT_MAX);
+        }
+    }
+
+    // Перед копированием конечная производная последовательность вычисляется: копия не
+    // должна зависеть от исходных последовательностей, которые могут быть уже удалены
+    // или перезаписаны самой копией (left = *left.Concat(...))
+    static MArraySequence<T>* CopyCash(const LazySequence& other)
+    {
+        other.Drain();
+        return other.cash ? new MArraySequence<T>(*other.cash) : nullptr;
+    }
+
+public:
+    // Конструкторы
+    LazySequence() : cash(new MArraySequence<T>()), ExCntr(0), rule(nullptr), generationThreads(1), source(nullptr), infinite(false)
+    {
+    }
+
+    explicit LazySequence(T* items, int count) : cash(new MArraySequence<T>(items, count)), ExCntr(0), rule(nullptr), generationThreads(1), source(nullptr), infinite(false)
+    {
+    }
+
+    explicit LazySequence(MArraySequence<T>* seq) : cash(seq ? seq : new MArraySequence<T>()), ExCntr(cash ? cash->GetLength() : 0), rule(nullptr), generationThreads(1), source(nullptr), infinite(false)
+    {
+    }
+
+    explicit LazySequence(std::function<T(int)> genFunc, int k) : cash(nullptr), ExCntr(0), rule(nullptr), generationThreads(1), source(nullptr), infinite(false)
+    {
+        if (!genFunc)
         {
-            rule = nullptr;
+            throw std::invalid_argument("rule is empty");
+        }
+        rule = [genFunc](int start, T* out, int count)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    out[i] = genFunc(start + i);
+                }
+            };
+        cash = new MArraySequence<T>();
+        Materialize(k);
+    }
+
+    // Правило, заполняющее сразу блок: blockRule(start, out, count)
+    explicit LazySequence(std::function<void(int, T*, int)> blockRule, int k) : cash(nullptr), ExCntr(0), rule(std::move(blockRule)), generationThreads(1), source(nullptr), infinite(false)
+    {
+        if (!rule)
+        {
+            throw std::invalid_argument("rule is empty");
         }
+        cash = new MArraySequence<T>();
+        Materialize(k);
     }
 
-    LazySequence(LazySequence&& other) noexcept : cash(other.cash), ExCntr(other.ExCntr), rule(other.rule)
+    // Последовательность, элементы которой по запросу вытягиваются из ленивого конвейера.
+    // endless — конвейер бесконечен: длиной тогда считается число уже вычисленных элементов
+    template <class Stage>
+    explicit LazySequence(const LazyPipeline<Stage>& pipeline, bool endless = false) : cash(new MArraySequence<T>()), ExCntr(0), rule(nullptr), generationThreads(1), source(nullptr), infinite(endless)
+    {
+        // Тип элементов конвейера может отличаться от T (Map<double> над int и т.п.)
+        Stage stage(pipeline.GetStage());
+        source = [stage](T& out) mutable
+            {
+                typename Stage::value_type item;
+                if (!stage.Next(item))
+                {
+                    return false;
+                }
+                out = item;
+                return true;
+            };
+    }
+
+    LazySequence(const LazySequence& other) : cash(CopyCash(other)), ExCntr(other.ExCntr), rule(other.rule), generationThreads(other.generationThreads), source(other.source), infinite(other.infinite), eviction(other.eviction)
+    {
+    }
+
+    LazySequence(LazySequence&& other) noexcept : cash(other.cash), ExCntr(other.ExCntr), rule(std::move(other.rule)), generationThreads(other.generationThreads), source(std::move(other.source)), infinite(other.infinite), eviction(std::move(other.eviction))
     {
         other.cash = nullptr;
         other.ExCntr = 0;
         other.rule = nullptr;
+        other.source = nullptr;
+        other.eviction = EvictionState();
     }
 
     LazySequence& operator=(const LazySequence& other)
     {
         if (this != &other)
         {
+            MArraySequence<T>* copied = CopyCash(other);
             delete cash;
-            delete rule;
-            cash = other.cash ? new MArraySequence<T>(*other.cash) : nullptr;
+            cash = copied;
             ExCntr = other.ExCntr;
-            if (other.rule)
-            {
-                rule = new std::function<T(int)>(*other.rule);
-            }
-            else
-            {
-                rule = nullptr;
-            }
+            rule = other.rule;
+            generationThreads = other.generationThreads;
+            source = other.source;
+            infinite = other.infinite;
+            eviction = other.eviction;
         }
         return *this;
     }
@@ -85,12 +377,17 @@ public:
         if (this != &other)
         {
             delete cash;
-            delete rule;
             cash = other.cash;
-            rule = other.rule;
+            rule = std::move(other.rule);
+            generationThreads = other.generationThreads;
+            source = std::move(other.source);
+            infinite = other.infinite;
+            eviction = std::move(other.eviction);
             ExCntr = other.ExCntr;
+            other.eviction = EvictionState();
             other.cash = nullptr;
             other.rule = nullptr;
+            other.source = nullptr;
             other.ExCntr = 0;
         }
         return *this;
@@ -99,7 +396,6 @@ public:
     ~LazySequence()
     {
         delete cash;
-        delete rule;
     }
 
     // Методы доступа
@@ -113,13 +409,17 @@ public:
         {
             throw std::out_of_range("Negative index");
         }
-        if (rule && index >= cash->GetLength())
+        if (rule && eviction.policy != CachePolicy::KeepAll)
         {
-            for (int i = cash->GetLength(); i <= index; ++i)
-            {
-                cash->Append((*rule)(i));
-                ExCntr++;
-            }
+            return GetEvicting(index);
+        }
+        if (rule)
+        {
+            Materialize(index + 1);
+        }
+        else if (source)
+        {
+            Pull(index + 1);
         }
         if (index >= cash->GetLength())
         {
@@ -135,16 +435,83 @@ public:
 
     T GetLast()
     {
-        if (!cash || cash->GetLength() == 0)
+        if (cash)
+        {
+            Drain();
+        }
+        if (!cash || GetLength().index == 0)
         {
             throw std::out_of_range("Sequence is empty");
         }
+        if (eviction.policy != CachePolicy::KeepAll)
+        {
+            return Get(GetLength().index - 1);
+        }
         return cash->Get(cash->GetLength() - 1);
     }
 
     Cardinal GetLength() const
     {
-        return cash ? Cardinal(0, cash->GetLength()) : Cardinal(0, 0);
+        if (cash)
+        {
+            Drain();
+        }
+        return cash ? Cardinal(0, eviction.base + cash->GetLength()) : Cardinal(0, 0);
+    }
+
+    // Бесконечная последовательность: задана правилом или получена из бесконечной
+    bool IsInfinite() const
+    {
+        return rule != nullptr || (source != nullptr && infinite);
+    }
+
+    // Элемент по индексу без записи в кэш: для последовательности с правилом недостающий
+    // элемент вычисляется заново. false — индекс за концом конечной последовательности
+    bool Peek(int index, T& out)
+    {
+        if (!cash || index < 0)
+        {
+            return false;
+        }
+        if (FindCached(index, out))
+        {
+            return true;
+        }
+        if (rule)
+        {
+            out = Compute(index);
+            return true;
+        }
+        if (Pull(index + 1))
+        {
+            out = cash->Get(index);
+            return true;
+        }
+        return false;
+    }
+
+    // Ленивый конвейер по элементам последовательности. Последовательность должна жить,
+    // пока конвейер используется
+    LazyPipeline<SequenceSource<T>> Pipe()
+    {
+        if (!cash)
+        {
+            throw std::runtime_error("Accessing destroyed sequence");
+        }
+        return LazyPipeline<SequenceSource<T>>(SequenceSource<T>(this));
+    }
+
+    // Конвейер, владеющий копией этой последовательности: на нём построены Concat/Map/Where/Zip,
+    // поэтому их результаты (и копии результатов) не зависят от времени жизни исходной.
+    // Копируется кэш, O(его длины); источник производной последовательности копируется
+    // неглубоко — её собственный владелец общий
+    LazyPipeline<SequenceSource<T>> OwnedPipe() const
+    {
+        if (!cash)
+        {
+            throw std::runtime_error("Accessing destroyed sequence");
+        }
+        return LazyPipeline<SequenceSource<T>>(SequenceSource<T>(SmartPointer<LazySequence<T>>::make_single(*this)));
     }
 
     size_t GetExCntr() const
@@ -152,11 +519,81 @@ public:
         return ExCntr;
     }
 
+    // Политика хранения вычисленных по правилу элементов. size — длина окна для
+    // SlidingWindow или размер блока для LruBlocks, blockCount — число блоков LRU.
+    // Вытесненный элемент при следующем чтении вычисляется заново, и это учитывается
+    // в GetExCntr. Последовательность с вытеснением нельзя изменять
+    LazySequence* SetCachePolicy(CachePolicy policy, int size = 0, int blockCount = 0)
+    {
+        if (!cash)
+        {
+            throw std::runtime_error("Accessing destroyed sequence");
+        }
+        if (!rule)
+        {
+            throw std::logic_error("Cache policy applies only to rule-based sequences");
+        }
+        if ((policy == CachePolicy::SlidingWindow || policy == CachePolicy::LruBlocks) && size <= 0)
+        {
+            throw std::invalid_argument("Window or block size must be positive");
+        }
+        if (policy == CachePolicy::LruBlocks && blockCount <= 0)
+        {
+            throw std::invalid_argument("Block count must be positive");
+        }
+        if (policy == CachePolicy::KeepAll && eviction.base > 0)
+        {
+            throw std::logic_error("Evicted elements cannot be restored");
+        }
+
+        int length = GetLength().index;
+        eviction.policy = policy;
+        eviction.size = size;
+        eviction.blockCount = blockCount;
+        eviction.blocks.clear();
+        if (policy == CachePolicy::SlidingWindow)
+        {
+            if (cash->GetLength() > size)
+            {
+                KeepLast(size);
+            }
+        }
+        else if (policy != CachePolicy::KeepAll)
+        {
+            *cash = MArraySequence<T>();
+            eviction.base = length;
+        }
+        return this;
+    }
+
+    CachePolicy GetCachePolicy() const
+    {
+        return eviction.policy;
+    }
+
+    // Для чистого правила (результат зависит только от индекса): большие недостающие
+    // диапазоны вычисляются в threadCount потоках; 0 — по числу ядер, 1 — последовательно
+    LazySequence* SetGenerationThreads(int threadCount)
+    {
+        if (threadCount < 0)
+        {
+            throw std::invalid_argument("Negative thread count");
+        }
+        if (threadCount == 0)
+        {
+            threadCount = DefaultThreadCount();
+        }
+        generationThreads = threadCount;
+        return this;
+    }
+
     // Методы модификации
     LazySequence* Append(T item)
     {
+        RequireKeepAll();
         if (cash)
         {
+            Drain();
             cash->Append(item);
         }
         return this;
@@ -164,6 +601,7 @@ public:
 
     LazySequence* Prepend(T item)
     {
+        RequireKeepAll();
         if (cash)
         {
             cash->Prepend(item);
@@ -173,8 +611,10 @@ public:
 
     LazySequence* InsertAt(T item, int index)
     {
+        RequireKeepAll();
         if (cash)
         {
+            Pull(index);
             cash->InsertAt(item, index);
         }
         return this;
@@ -196,90 +636,92 @@ public:
         return new LazySequence(newArray);
     }
 
-    // Композиционные методы
+    // Композиционные методы. Результаты Concat/Map/Where/Zip ленивые: элементы вычисляются
+    // при обращении к ним и вытягиваются из снимков исходных последовательностей (OwnedPipe),
+    // так что исходные можно удалять и менять. Цепочку без промежуточных кэшей даёт Pipe()
     LazySequence* Concat(LazySequence* list)
     {
         if (!cash || !list || !list->cash)
         {
             throw std::invalid_argument("Invalid sequences for concatenation");
         }
-
-        // Безопасная ручная реализация конкатенации
-        MArraySequence<T>* newArray = new MArraySequence<T>();
-
-        // Копируем элементы из текущей последовательности
-        for (int i = 0; i < this->GetLength().index; ++i)
-        {
-            newArray->Append(this->Get(i));
-        }
-
-        // Копируем элементы из второй последовательности
-        for (int i = 0; i < list->GetLength().index; ++i)
-        {
-            newArray->Append(list->Get(i));
-        }
-
-        return new LazySequence(newArray);
+        return new LazySequence(OwnedPipe().Concat(list->OwnedPipe()), IsInfinite() || list->IsInfinite());
     }
 
-    // Функциональные методы
-    template<class T2>
-    LazySequence<T2>* Map(T2(*func)(T))
+    // Функциональные методы. Принимают любой вызываемый объект (функцию, лямбду с захватом,
+    // функтор): его тип — параметр шаблона, поэтому тело встраивается в цикл по элементам.
+    // Map<T2> приводит результат к T2; без явного T2 берётся тип, возвращаемый func
+    template<class T2 = void, class Func>
+    LazySequence<typename MapResult<T2, Func, T>::type>* Map(Func func)
     {
         if (!cash)
         {
             throw std::runtime_error("Accessing destroyed sequence");
         }
-
-        // Ручная реализация Map
-        MArraySequence<T2>* resultArray = new MArraySequence<T2>();
-        for (int i = 0; i < cash->GetLength(); ++i)
-        {
-            resultArray->Append(func(cash->Get(i)));
-        }
-        return new LazySequence<T2>(resultArray);
+        return new LazySequence<typename MapResult<T2, Func, T>::type>(OwnedPipe().Map(std::move(func)), IsInfinite());
     }
 
-    template<class T2>
-    T2 Reduce(T2(*func)(T2, T), T2 initial)
+    // Свёртка уже вычисленных элементов; конечная последовательность вычисляется целиком
+    template<class T2, class Func>
+    T2 Reduce(Func func, T2 initial)
     {
         if (!cash)
         {
             throw std::runtime_error("Accessing destroyed sequence");
         }
 
-        // Ручная реализация Reduce
+        Drain();
         T2 result = initial;
-        for (int i = 0; i < cash->GetLength(); ++i)
+        if (eviction.policy != CachePolicy::KeepAll)
         {
-            result = func(result, cash->Get(i));
+            // Вытесненные элементы вычисляются заново
+            int length = GetLength().index;
+            for (int i = 0; i < length; ++i)
+            {
+                result = func(result, Get(i));
+            }
+            return result;
         }
-        return result;
+        return cash->template Reduce<T2>(func, result);
+    }
+
+    // Параллельная свёртка вычисленных элементов ассоциативной операцией op с нейтральным
+    // элементом identity; результат не зависит от числа потоков (см. ParallelOps.hpp)
+    template<class Op>
+    T ParallelReduce(Op op, T identity, int threads = 0)
+    {
+        RequireMaterialized();
+        return cash->ParallelReduce(op, identity, threads);
     }
 
-    LazySequence* Where(bool (*predicate)(T))
+    T ParallelSum(SumMode mode = SumMode::Plain, int threads = 0)
+    {
+        RequireMaterialized();
+        return cash->ParallelSum(mode, threads);
+    }
+
+    // Отображение вычисленных элементов в заранее выделенный массив из GetLength() элементов
+    template<class T2, class Func>
+    void ParallelMap(Func func, T2* out, int threads = 0)
+    {
+        RequireMaterialized();
+        cash->ParallelMap(func, out, threads);
+    }
+
+    template<class Predicate>
+    LazySequence* Where(Predicate predicate)
     {
         if (!cash)
         {
             throw std::runtime_error("Accessing destroyed sequence");
         }
-
-        // Ручная реализация Where
-        MArraySequence<T>* resultArray = new MArraySequence<T>();
-        for (int i = 0; i < cash->GetLength(); ++i)
-        {
-            T current = cash->Get(i);
-            if (predicate(current))
-            {
-                resultArray->Append(current);
-            }
-        }
-        return new LazySequence(resultArray);
+        return new LazySequence(OwnedPipe().Where(std::move(predicate)), IsInfinite());
     }
 
-    LazySequence* Zip(LazySequence* seq, T(*zipper)(T, T))
+    template<class Zipper>
+    LazySequence* Zip(LazySequence* seq, Zipper zipper)
     {
-        if (!zipper)
+        if (IsNullCallable(zipper))
         {
             throw std::invalid_argument("Zipper function cannot be null");
         }
@@ -287,173 +729,347 @@ public:
         {
             throw std::invalid_argument("Invalid sequences for zip");
         }
-
-        // Ручная реализация Zip
-        MArraySequence<T>* resultArray = new MArraySequence<T>();
-        int minLength = std::min(this->GetLength().index, seq->GetLength().index);
-
-        for (int i = 0; i < minLength; ++i)
-        {
-            resultArray->Append(zipper(this->Get(i), seq->Get(i)));
-        }
-
-        return new LazySequence(resultArray);
+        return new LazySequence(OwnedPipe().Zip(seq->OwnedPipe(), std::move(zipper)), IsInfinite() && seq->IsInfinite());
     }
 };
-/*
+// Сегмент составной последовательности: элементы [start, start + length) исходной
+// последовательности parent (infinite — до бесконечности). Исходная последовательность
+// общая для всех сегментов, вырезанных из неё, и живёт, пока на неё есть ссылки
 template<class T>
 class LasyPointer
 {
 public:
-    LazySequence<T>* parent;
-    Cardinal breakPoint;  // Граничный индекс, ДО которого работает этот сегмент
+    SmartPointer<LazySequence<T>> parent;
+    int start;
+    int length;
+    bool infinite;
 
-    LasyPointer() : parent(nullptr), breakPoint(0, 0) {}
+    LasyPointer() : parent(), start(0), length(0), infinite(false) {}
 
-    explicit LasyPointer(LazySequence<T>* seq, Cardinal breakPt)
-        : parent(seq), breakPoint(breakPt) {
+    LasyPointer(const SmartPointer<LazySequence<T>>& seq, int first, int count, bool endless)
+        : parent(seq), start(first), length(count), infinite(endless)
+    {
     }
 
-    bool isValid() const { return parent != nullptr; }
-    Cardinal GetBreakPoint() const { return breakPoint; }
-    LazySequence<T>* GetParent() const { return parent; }
+    T Get(int index) const
+    {
+        return parent->Get(start + index);
+    }
 
-    // Проверяем, попадает ли индекс в этот сегмент
-    bool containsIndex(const Cardinal& index) const {
-        return index < breakPoint;  // Используем наш оператор <
+    // Часть сегмента без копирования элементов; count < 0 — до конца
+    LasyPointer Slice(int first, int count) const
+    {
+        if (count < 0)
+        {
+            return LasyPointer(parent, start + first, infinite ? 0 : length - first, infinite);
+        }
+        return LasyPointer(parent, start + first, count, false);
     }
 };
 
+// Составная ленивая последовательность (верёвка): сегменты из вычисленных массивов и
+// генераторов в листьях сбалансированного (AVL) дерева, узел знает длину своего поддерева.
+// Узлы неизменяемые и общие между последовательностями, поэтому Concat, GetSubsequence,
+// InsertAt и Prepend строят O(log k) новых узлов и не копируют элементы; Get спускается по
+// дереву за O(log k), k — число сегментов. Бесконечным может быть только последний сегмент
 template<class T>
 class MixedLazySequence
 {
 private:
-    MArraySequence<LasyPointer<T>> segments;
+    struct Node;
+    typedef SmartPointer<Node, PlainRefCount> NodePtr;
 
-public:
-    MixedLazySequence() = default;
+    struct Node
+    {
+        LasyPointer<T> segment; // только в листе
+        NodePtr left;
+        NodePtr right;
+        int length;             // конечная часть поддерева
+        bool infinite;
+        int height;
+        int segments;
+    };
+
+    NodePtr root;
+
+    static int Height(const NodePtr& node)
+    {
+        return node ? node->height : 0;
+    }
 
-    MixedLazySequence(LazySequence<T>* seq1, Cardinal index, LazySequence<T>* seq2)
+    static NodePtr MakeLeaf(const LasyPointer<T>& segment)
     {
-        // Первый сегмент: работает ДО index
-        segments.Append(LasyPointer<T>(seq1, index));
+        if (!segment.infinite && segment.length == 0)
+        {
+            return NodePtr();
+        }
+        NodePtr node = NodePtr::make_single();
+        node->segment = segment;
+        node->length = segment.infinite ? 0 : segment.length;
+        node->infinite = segment.infinite;
+        node->height = 1;
+        node->segments = 1;
+        return node;
+    }
 
-        // Второй сегмент: работает ДО (index + длина seq2)
-        Cardinal seq2Length = seq2->GetLength();
-        Cardinal seq2End = index + Cardinal(0, seq2Length.index); // Исправил GetLength()
-        segments.Append(LasyPointer<T>(seq2, seq2End));
+    static NodePtr MakeNode(const NodePtr& left, const NodePtr& right)
+    {
+        if (left->length > INT_MAX - right->length)
+        {
+            throw std::length_error("Sequence is too long");
+        }
+        NodePtr node = NodePtr::make_single();
+        node->left = left;
+        node->right = right;
+        node->length = left->length + right->length;
+        node->infinite = right->infinite;
+        node->height = 1 + std::max(left->height, right->height);
+        node->segments = left->segments + right->segments;
+        return node;
+    }
 
-        // Третий сегмент: работает ДО бесконечности (максимальное значение)
-        segments.Append(LasyPointer<T>(seq1, Cardinal(INT_MAX, INT_MAX)));
+    // Узел из поддеревьев, высоты которых отличаются не больше чем на 2, с поворотами AVL
+    static NodePtr Balance(const NodePtr& left, const NodePtr& right)
+    {
+        if (Height(left) > Height(right) + 1)
+        {
+            if (Height(left->left) >= Height(left->right))
+            {
+                return MakeNode(left->left, MakeNode(left->right, right));
+            }
+            return MakeNode(MakeNode(left->left, left->right->left), MakeNode(left->right->right, right));
+        }
+        if (Height(right) > Height(left) + 1)
+        {
+            if (Height(right->right) >= Height(right->left))
+            {
+                return MakeNode(MakeNode(left, right->left), right->right);
+            }
+            return MakeNode(MakeNode(left, right->left->left), MakeNode(right->left->right, right->right));
+        }
+        return MakeNode(left, right);
     }
 
-    MixedLazySequence(const MixedLazySequence<T>& other)
-        : segments(other.segments)
+    // Сцепление деревьев за O(разности высот). Элементы после бесконечной части недостижимы
+    static NodePtr Join(const NodePtr& left, const NodePtr& right)
     {
+        if (!left || left->infinite)
+        {
+            return left ? left : right;
+        }
+        if (!right)
+        {
+            return left;
+        }
+        if (left->height > right->height + 1)
+        {
+            return Balance(left->left, Join(left->right, right));
+        }
+        if (right->height > left->height + 1)
+        {
+            return Balance(Join(left, right->left), right->right);
+        }
+        return MakeNode(left, right);
     }
 
-    MixedLazySequence(MixedLazySequence<T>&& other)
-        : segments(std::move(other.segments))
+    // before — первые index элементов, after — остальные
+    static void Split(const NodePtr& node, int index, NodePtr& before, NodePtr& after)
     {
+        if (!node || index <= 0)
+        {
+            before = NodePtr();
+            after = node;
+            return;
+        }
+        if (!node->infinite && index >= node->length)
+        {
+            before = node;
+            after = NodePtr();
+            return;
+        }
+        if (!node->left)
+        {
+            before = MakeLeaf(node->segment.Slice(0, index));
+            after = MakeLeaf(node->segment.Slice(index, -1));
+            return;
+        }
+        NodePtr part;
+        if (index < node->left->length)
+        {
+            Split(node->left, index, before, part);
+            after = Join(part, node->right);
+        }
+        else
+        {
+            Split(node->right, index - node->left->length, part, after);
+            before = Join(node->left, part);
+        }
     }
 
-    T Get(const Cardinal& globalIndex)
+    explicit MixedLazySequence(const NodePtr& node) : root(node) {}
+
+    static NodePtr FromSequence(LazySequence<T>* seq)
     {
-        Cardinal accumulated(0, 0);
+        if (!seq)
+        {
+            throw std::invalid_argument("Sequence is null");
+        }
+        bool endless = seq->IsInfinite();
+        int count = endless ? 0 : seq->GetLength().index;
+        return MakeLeaf(LasyPointer<T>(SmartPointer<LazySequence<T>>(seq), 0, count, endless));
+    }
 
-        for (int i = 0; i < segments.GetLength(); i++) {
-            auto& segment = segments.Get(i);
-            Cardinal segmentEnd = segment.GetBreakPoint();
+    void CheckPosition(int index) const
+    {
+        int length = root ? root->length : 0;
+        if (index < 0 || (!IsInfinite() && index > length))
+        {
+            throw std::out_of_range("Index out of range");
+        }
+    }
 
-            // Если order совпадает И индекс попадает в сегмент
-            if (globalIndex.order == accumulated.order && globalIndex < segmentEnd) {
-                Cardinal localIndex = Cardinal(0, globalIndex.index - accumulated.index);
-                return segment.GetParent()->Get(localIndex.index);
-            }
+public:
+    MixedLazySequence() : root() {}
 
-            // Если это сегмент продолжения (order>0) И мы ищем элемент с таким же order
-            if (segmentEnd.order > accumulated.order && globalIndex.order == segmentEnd.order) {
-                // ДЛЯ ПРОДОЛЖЕНИЯ: accumulated обнуляется для нового order!
-                Cardinal localIndex = Cardinal(0, globalIndex.index); // accumulated = 0 для нового order
-                return segment.GetParent()->Get(localIndex.index + accumulated.index);
-            }
+    // Вычисленный участок из count элементов items
+    MixedLazySequence(T* items, int count) : root(FromSequence(new LazySequence<T>(items, count))) {}
+
+    // Генератор rule(0), rule(1), ...: count элементов либо бесконечно при count < 0.
+    // Элементы не хранятся, каждое чтение вычисляет элемент заново
+    explicit MixedLazySequence(std::function<T(int)> rule, int count = -1) : root()
+    {
+        SmartPointer<LazySequence<T>> shared(new LazySequence<T>(std::move(rule), 0));
+        shared->SetCachePolicy(CachePolicy::Recompute);
+        root = MakeLeaf(LasyPointer<T>(shared, 0, std::max(count, 0), count < 0));
+    }
+
+    // Сегмент по всей последовательности seq; владение seq переходит сюда
+    explicit MixedLazySequence(LazySequence<T>* seq) : root(FromSequence(seq)) {}
 
-            // Увеличиваем accumulated только если order совпадает
-            if (segmentEnd.order == accumulated.order) {
-                accumulated.index = segmentEnd.index;
+    T Get(int index) const
+    {
+        if (index < 0 || !root || (!root->infinite && index >= root->length))
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        const Node* node = root.get();
+        while (node->left)
+        {
+            if (index < node->left->length)
+            {
+                node = node->left.get();
             }
-            else {
-                // При переходе на новый order accumulated сбрасывается в 0 для этого order
-                accumulated = Cardinal(segmentEnd.order, 0);
+            else
+            {
+                index -= node->left->length;
+                node = node->right.get();
             }
         }
-
-        throw std::out_of_range("Index out of range");
+        return node->segment.Get(index);
     }
 
-    MixedLazySequence<T>* InsertLSeq(LazySequence<T>* seq, Cardinal position)
+    T GetFirst() const
     {
-        auto* result = new MixedLazySequence<T>();
-
-        bool inserted = false;
+        return Get(0);
+    }
 
-        for (int i = 0; i < segments.GetLength(); i++) {
-            auto& currentSegment = segments.Get(i);
-            Cardinal segmentStart = (i == 0) ? Cardinal(0, 0) : segments.Get(i - 1).GetBreakPoint();
-            Cardinal segmentEnd = currentSegment.GetBreakPoint();
+    T GetLast() const
+    {
+        if (IsInfinite() || !root)
+        {
+            throw std::out_of_range("Sequence has no last element");
+        }
+        return Get(root->length - 1);
+    }
 
-            // Если позиция вставки находится внутри этого сегмента
-            if (!inserted && position < segmentEnd) {
-                // Разбиваем текущий сегмент на части
+    // Длина; у бесконечной — Cardinal(1, 0) (первый бесконечный порядок)
+    Cardinal GetLength() const
+    {
+        if (IsInfinite())
+        {
+            return Cardinal(1, 0);
+        }
+        return Cardinal(0, root ? root->length : 0);
+    }
 
-                // 1. Часть ДО вставки
-                if (position > segmentStart) {
-                    result->segments.Append(LasyPointer<T>(
-                        currentSegment.GetParent(),
-                        position
-                    ));
-                }
+    bool IsInfinite() const
+    {
+        return root && root->infinite;
+    }
 
-                // 2. Вставляемая последовательность
-                Cardinal insertEnd = position + Cardinal(0, seq->GetLength().index);
-                result->segments.Append(LasyPointer<T>(seq, insertEnd));
+    int GetSegmentCount() const
+    {
+        return root ? root->segments : 0;
+    }
 
-                // 3. Часть ПОСЛЕ вставки
-                result->segments.Append(LasyPointer<T>(
-                    currentSegment.GetParent(),
-                    segmentEnd
-                ));
+    int GetDepth() const
+    {
+        return Height(root);
+    }
 
-                inserted = true;
-            }
-            else {
-                // Просто копируем сегмент
-                result->segments.Append(currentSegment);
-            }
+    // Новая последовательность: эта, затем list (если эта бесконечна — только эта)
+    MixedLazySequence* Concat(const MixedLazySequence* list) const
+    {
+        if (!list)
+        {
+            throw std::invalid_argument("Invalid sequence for concatenation");
         }
+        return new MixedLazySequence(Join(root, list->root));
+    }
 
-        // Если не вставили (позиция больше всех сегментов), добавляем в конец
-        if (!inserted) {
-            Cardinal insertEnd = segments.Get(segments.GetLength() - 1).GetBreakPoint() +
-                Cardinal(0, seq->GetLength().index);
-            result->segments.Append(LasyPointer<T>(seq, insertEnd));
+    // Элементы с startIndex по endIndex включительно
+    MixedLazySequence* GetSubsequence(int startIndex, int endIndex) const
+    {
+        if (startIndex < 0 || endIndex < startIndex - 1 || (!IsInfinite() && endIndex >= GetLength().index))
+        {
+            throw std::out_of_range("Invalid subsequence bounds");
         }
-
-        return result;
+        NodePtr head;
+        NodePtr tail;
+        NodePtr middle;
+        Split(root, endIndex + 1, head, tail);
+        Split(head, startIndex, tail, middle);
+        return new MixedLazySequence(middle);
     }
 
-    ~MixedLazySequence() = default;
+    // Новая последовательность с seq, вставленной перед элементом position
+    MixedLazySequence* InsertLSeq(const MixedLazySequence* seq, int position) const
+    {
+        if (!seq)
+        {
+            throw std::invalid_argument("Invalid sequence for insertion");
+        }
+        CheckPosition(position);
+        NodePtr before;
+        NodePtr after;
+        Split(root, position, before, after);
+        return new MixedLazySequence(Join(Join(before, seq->root), after));
+    }
 
-    // Дополнительные методы
-    size_t GetSegmentCount() const { return segments.GetLength(); }
+    // Методы модификации: элемент становится отдельным сегментом
+    MixedLazySequence* InsertAt(T item, int index)
+    {
+        CheckPosition(index);
+        MixedLazySequence single(&item, 1);
+        NodePtr before;
+        NodePtr after;
+        Split(root, index, before, after);
+        root = Join(Join(before, single.root), after);
+        return this;
+    }
 
-    Cardinal GetTotalLength() const
+    MixedLazySequence* Prepend(T item)
     {
-        if (segments.GetLength() == 0) return Cardinal(0, 0);
+        MixedLazySequence single(&item, 1);
+        root = Join(single.root, root);
+        return this;
+    }
 
-        // Берем breakPoint последнего сегмента (самый большой)
-        return segments.Get(segments.GetLength() - 1).GetBreakPoint();
+    MixedLazySequence* Append(T item)
+    {
+        MixedLazySequence single(&item, 1);
+        root = Join(root, single.root);
+        return this;
     }
 };
-*/
 
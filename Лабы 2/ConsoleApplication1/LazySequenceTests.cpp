@@ -1,5 +1,10 @@
 #include "LazySequenceTests.hpp"
 #include <iostream>
+#include <vector>
+#include <string>
+#include <climits>
+#include <cmath>
+#include <random>
 using namespace std;
 
 void LazySequenceTests::test_constructors()
@@ -238,6 +243,486 @@ void LazySequenceTests::test_exceptions()
     cout << "Exception tests passed!\n";
 }
 
+void LazySequenceTests::test_lazy_pipelines()
+{
+    cout << "Testing lazy pipelines...\n";
+
+    // Map/Where       
+    int items[] = { 1, 2, 3, 4, 5, 6 };
+    LazySequence<int> seq(items, 6);
+    auto squares = seq.Map<int>([](int x) { return x * x; });
+    assert(squares->GetExCntr() == 0);
+    assert(squares->Get(1) == 4);
+    assert(squares->GetExCntr() == 2);
+    assert(squares->GetLength().index == 6);
+    assert(squares->GetLast() == 36);
+    delete squares;
+
+    // Where   
+    LazySequence<int> naturals([](int n) { return n; }, 0);
+    auto multiplesOf7 = naturals.Where([](int x) { return x % 7 == 0 && x > 0; });
+    assert(multiplesOf7->IsInfinite());
+    assert(multiplesOf7->Get(2) == 21);
+    assert(multiplesOf7->GetExCntr() == 3);
+    assert(naturals.GetLength().index == 0); //    
+    delete multiplesOf7;
+
+    //  :     
+    auto pipeline = naturals.Pipe()
+        .Map([](int x) { return (long long)x * 3; })
+        .Where([](long long x) { return x % 2 == 1; })
+        .Take(4);
+    assert(pipeline.Reduce([](long long acc, long long x) { return acc + x; }, 0LL) == 3 + 9 + 15 + 21);
+    assert(pipeline.Count() == 4);
+    assert(pipeline.Get(3) == 21);
+    assert(naturals.GetLength().index == 0);
+
+    long long expected = 3;
+    for (long long x : pipeline)
+    {
+        assert(x == expected);
+        expected += 6;
+    }
+    assert(expected == 27);
+
+    //  Concat  Zip
+    int moreItems[] = { 7, 8 };
+    LazySequence<int> more(moreItems, 2);
+    auto joined = seq.Concat(&more);
+    assert(joined->GetExCntr() == 0);
+    assert(joined->Get(6) == 7);
+    assert(joined->GetLength().index == 8);
+    delete joined;
+
+    auto sums = naturals.Zip(&seq, [](int a, int b) { return a + b; });
+    assert(!sums->IsInfinite());
+    assert(sums->GetLength().index == 6);
+    assert(sums->GetLast() == 11);
+    delete sums;
+
+    //   
+    LazySequence<int> firstSquares(naturals.Pipe().Map([](int x) { return x * x; }).Take(5));
+    assert(firstSquares.GetLength().index == 5);
+    assert(firstSquares.Get(4) == 16);
+
+    //         
+    int calls = 0;
+    int offset = 100;
+    auto shifted = seq.Map([&calls, offset](int x) { ++calls; return x + offset; });
+    assert(shifted->Get(0) == 101);
+    assert(calls == 1);
+    delete shifted;
+
+    int threshold = 3;
+    auto large = seq.Where([threshold](int x) { return x > threshold; });
+    assert(large->GetLength().index == 3);
+    delete large;
+    assert(seq.Reduce(std::plus<long long>(), 0LL) == 21);
+
+    //       :     
+    LazySequence<int>* source = new LazySequence<int>(items, 6);
+    LazySequence<int>* evens = source->Where([](int x) { return x % 2 == 0; });
+    LazySequence<int>* tens = source->Map([](int x) { return x * 10; });
+    delete source;
+    LazySequence<int> evensCopy(*evens);
+    LazySequence<int>* evenTens = evens->Map([](int x) { return x * 10; });
+    delete evens;
+    assert(evensCopy.GetLength().index == 3 && evensCopy.Get(2) == 6);
+    assert(evenTens->Get(1) == 40 && evenTens->GetLength().index == 3);
+    assert(tens->Get(5) == 60);
+    LazySequence<int>* zipped = tens->Zip(evenTens, [](int a, int b) { return a + b; });
+    LazySequence<int>* chained = zipped->Concat(tens);
+    delete tens;
+    delete evenTens;
+    delete zipped;
+    assert(chained->GetLength().index == 9);
+    assert(chained->Get(0) == 10 + 20 && chained->Get(8) == 60);
+    delete chained;
+
+    //   :    
+    assert(Generate([](int n) { return n * n; }).Take(4).Reduce([](int acc, int x) { return acc + x; }, 0) == 14);
+
+    cout << "Lazy pipeline tests passed!\n";
+}
+
+void LazySequenceTests::test_block_generation()
+{
+    cout << "Testing block generation...\n";
+
+    //           
+    int blockCalls = 0;
+    std::function<void(int, long long*, int)> squares = [&blockCalls](int start, long long* out, int count)
+        {
+            ++blockCalls;
+            for (int i = 0; i < count; ++i)
+            {
+                out[i] = (long long)(start + i) * (start + i);
+            }
+        };
+    LazySequence<long long> seq(squares, 10);
+    assert(blockCalls == 1);
+    assert(seq.Get(100000) == 10000000000LL);
+    assert(blockCalls == 2);
+    assert(seq.GetExCntr() == 100001);
+    assert(seq.Get(5) == 25);
+    assert(blockCalls == 2);
+
+    long long peeked = 0;
+    assert(seq.Peek(200000, peeked) && peeked == 40000000000LL);
+    assert(seq.GetLength().index == 100001);
+
+    //        
+    std::function<void(int, int*, int)> hash = [](int start, int* out, int count)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                unsigned x = (unsigned)(start + i) * 2654435761u;
+                out[i] = (int)(x ^ (x >> 16));
+            }
+        };
+    LazySequence<int> serial(hash, 0);
+    LazySequence<int> parallel(hash, 0);
+    parallel.SetGenerationThreads(4);
+    assert(serial.Get(300000) == parallel.Get(300000));
+    for (int i = 0; i <= 300000; i += 997)
+    {
+        assert(serial.Get(i) == parallel.Get(i));
+    }
+
+    //         
+    std::function<void(int, int*, int)> failing = [](int start, int* out, int count)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                if (start + i == 50)
+                {
+                    throw std::runtime_error("rule failed");
+                }
+                out[i] = start + i;
+            }
+        };
+    LazySequence<int> fragile(failing, 10);
+    try
+    {
+        fragile.Get(60);
+        assert(false);
+    }
+    catch (const runtime_error&) {}
+    assert(fragile.GetLength().index == 10);
+    assert(fragile.Get(49) == 49);
+
+    cout << "Block generation tests passed!\n";
+}
+
+void LazySequenceTests::test_cache_policies()
+{
+    cout << "Testing cache policies...\n";
+
+    auto triple = [](int n) { return 3 * n; };
+
+    //  :  ,    
+    LazySequence<int> window(triple, 0);
+    window.SetCachePolicy(CachePolicy::SlidingWindow, 100);
+    for (int i = 0; i < 10000; ++i)
+    {
+        assert(window.Get(i) == 3 * i);
+    }
+    assert(window.GetExCntr() == 10000);
+    assert(window.GetLength().index == 10000);
+    assert(window.Get(9950) == 3 * 9950); //   
+    assert(window.GetExCntr() == 10000);
+    assert(window.Get(10) == 30);         // 
+    assert(window.GetExCntr() == 10001);
+    assert(window.GetLast() == 3 * 9999);
+
+    //      ,      
+    assert(window.Get(1000000) == 3000000);
+    assert(window.GetExCntr() == 10101);
+
+    // LRU     64 
+    LazySequence<int> lru(triple, 0);
+    lru.SetCachePolicy(CachePolicy::LruBlocks, 64, 2);
+    assert(lru.Get(5) == 15);
+    assert(lru.GetExCntr() == 64);
+    assert(lru.Get(70) == 210);
+    assert(lru.Get(6) == 18);   //  0  
+    assert(lru.GetExCntr() == 128);
+    assert(lru.Get(200) == 600); //   1,   
+    assert(lru.Get(7) == 21);
+    assert(lru.GetExCntr() == 192);
+    assert(lru.Get(71) == 213);  //  1  
+    assert(lru.GetExCntr() == 256);
+
+    //  :    
+    LazySequence<int> recompute(triple, 10);
+    recompute.SetCachePolicy(CachePolicy::Recompute);
+    assert(recompute.GetLength().index == 10);
+    assert(recompute.Get(3) == 9);
+    assert(recompute.Get(3) == 9);
+    assert(recompute.GetExCntr() == 12);
+    assert(recompute.Get(20) == 60);
+    assert(recompute.GetLength().index == 21);
+    assert(recompute.Reduce([](long long acc, int x) { return acc + x; }, 0LL) == 3 * 210);
+
+    // 
+    try
+    {
+        recompute.Append(1);
+        assert(false);
+    }
+    catch (const logic_error&) {}
+    try
+    {
+        recompute.SetCachePolicy(CachePolicy::KeepAll);
+        assert(false);
+    }
+    catch (const logic_error&) {}
+    int items[] = { 1, 2 };
+    LazySequence<int> plain(items, 2);
+    try
+    {
+        plain.SetCachePolicy(CachePolicy::Recompute);
+        assert(false);
+    }
+    catch (const logic_error&) {}
+
+    LazySequence<int> copy(window);
+    assert(copy.GetCachePolicy() == CachePolicy::SlidingWindow);
+    assert(copy.Get(999999) == 2999997);
+
+    cout << "Cache policy tests passed!\n";
+}
+
+void LazySequenceTests::test_non_trivial_elements()
+{
+    cout << "Testing non-trivially-copyable elements...\n";
+
+    //        std::string
+    auto stars = [](int i) { return string(i + 1, 'x'); };
+    LazySequence<string> words(stars, 10);
+    assert(words.Get(3) == "xxxx");
+    assert(words.Get(9) == string(10, 'x'));
+    assert(words.GetExCntr() == 10);
+
+    //       KeepLast
+    LazySequence<string> window(stars, 0);
+    window.SetCachePolicy(CachePolicy::SlidingWindow, 4);
+    for (int i = 0; i < 50; ++i)
+    {
+        assert(window.Get(i) == string(i + 1, 'x'));
+    }
+    assert(window.Get(2) == "xxx");
+
+    // AppendN    ;     
+    MArraySequence<string> block;
+    block.AppendN(3, [](size_t i) { return string(100, (char)('a' + i)); });
+    assert(block.GetLength() == 3);
+    assert(block.Get(2) == string(100, 'c'));
+    try
+    {
+        block.AppendN(5, [](size_t i)
+            {
+                if (i == 3)
+                {
+                    throw runtime_error("generator failed");
+                }
+                return string(100, 'z');
+            });
+        assert(false);
+    }
+    catch (const runtime_error&) {}
+    assert(block.GetLength() == 3);
+    block.Append("d");
+    assert(block.GetLength() == 4 && block.Get(3) == "d");
+
+    cout << "Non-trivial element tests passed!\n";
+}
+
+void LazySequenceTests::test_parallel_operations()
+{
+    cout << "Testing parallel operations...\n";
+
+    //   ParallelChunk,  
+    const int n = 300001;
+    LazySequence<long long> seq([](int i) { return (long long)(i % 1000) - 500; }, n);
+    long long serial = seq.Reduce([](long long acc, long long x) { return acc + x; }, 0LL);
+    auto plus = [](long long a, long long b) { return a + b; };
+    assert(seq.ParallelReduce(plus, 0LL, 1) == serial);
+    assert(seq.ParallelReduce(plus, 0LL, 4) == serial);
+    assert(seq.ParallelReduce([](long long a, long long b) { return std::min(a, b); }, LLONG_MAX, 3) == -500);
+    assert(seq.ParallelReduce([](long long a, long long b) { return std::max(a, b); }, LLONG_MIN, 3) == 499);
+
+    //     
+    std::vector<int> halves(n);
+    seq.ParallelMap([](long long x) { return (int)(x / 2); }, halves.data(), 4);
+    for (int i = 0; i < n; i += 1013)
+    {
+        assert(halves[i] == (int)(seq.Get(i) / 2));
+    }
+
+    //   float     ;     
+    MArraySequence<float> tenths;
+    const int m = 1000000;
+    float* out = tenths.ReserveBack(m);
+    for (int i = 0; i < m; ++i)
+    {
+        out[i] = 0.1f;
+    }
+    tenths.CommitBack(m);
+    double exact = m * (double)0.1f;
+    float plain = tenths.ParallelSum(SumMode::Plain, 1);
+    assert(tenths.ParallelSum(SumMode::Plain, 4) == plain);
+    float kahan = tenths.ParallelSum(SumMode::Kahan, 4);
+    assert(tenths.ParallelSum(SumMode::Kahan, 2) == kahan);
+    float pairwise = tenths.ParallelSum(SumMode::Pairwise, 3);
+    assert(std::abs(kahan - exact) <= std::abs(plain - exact));
+    assert(std::abs(kahan - exact) < 0.1);
+    assert(std::abs(pairwise - exact) < std::abs(plain - exact) / 10);
+
+    //     
+    MArraySequence<int> empty;
+    assert(empty.ParallelReduce([](int a, int b) { return a + b; }, 7, 4) == 7);
+
+    cout << "Parallel operation tests passed!\n";
+}
+
+void LazySequenceTests::test_segmented_sequences()
+{
+    cout << "Testing segmented sequences...\n";
+
+    //      
+    int items[] = { 100, 101, 102, 103, 104 };
+    MixedLazySequence<int> generated([](int i) { return 3 * i; }, 40);
+    MixedLazySequence<int> chunk(items, 5);
+    MixedLazySequence<int>* rope = generated.Concat(&chunk);
+    std::vector<int> model;
+    for (int i = 0; i < 40; ++i)
+    {
+        model.push_back(3 * i);
+    }
+    model.insert(model.end(), items, items + 5);
+
+    std::mt19937 rng(12345);
+    for (int step = 0; step < 600; ++step)
+    {
+        int length = (int)model.size();
+        int action = (int)(rng() % 6);
+        int position = (int)(rng() % (length + 1));
+        if (action == 0)
+        {
+            rope->InsertAt(-step, position);
+            model.insert(model.begin() + position, -step);
+        }
+        else if (action == 1)
+        {
+            rope->Prepend(step);
+            model.insert(model.begin(), step);
+        }
+        else if (action == 2)
+        {
+            rope->Append(step);
+            model.push_back(step);
+        }
+        else if (action == 3 && length > 0)
+        {
+            int last = position + (int)(rng() % (length - std::min(position, length - 1)));
+            last = std::min(last, length - 1);
+            position = std::min(position, last);
+            MixedLazySequence<int>* part = rope->GetSubsequence(position, last);
+            delete rope;
+            rope = part;
+            model = std::vector<int>(model.begin() + position, model.begin() + last + 1);
+        }
+        else if (length < 3000)
+        {
+            //    :  ,   
+            MixedLazySequence<int>* doubled = rope->InsertLSeq(rope, position);
+            delete rope;
+            rope = doubled;
+            std::vector<int> copy = model;
+            model.insert(model.begin() + position, copy.begin(), copy.end());
+        }
+
+        assert(rope->GetLength() == Cardinal(0, (int)model.size()));
+        for (size_t i = 0; i < model.size(); i += 1 + model.size() / 50)
+        {
+            assert(rope->Get((int)i) == model[i]);
+        }
+    }
+    for (size_t i = 0; i < model.size(); ++i)
+    {
+        assert(rope->Get((int)i) == model[i]);
+    }
+    delete rope;
+
+    //  :       ,   O(log k)
+    MixedLazySequence<long long> huge([](int i) { return 2LL * i; }, INT_MAX - 2000);
+    for (int k = 0; k < 1000; ++k)
+    {
+        huge.InsertAt(-1, k * 1000000);
+    }
+    assert(huge.GetLength() == Cardinal(0, INT_MAX - 1000));
+    assert(huge.GetSegmentCount() == 2000);
+    assert(huge.GetDepth() <= 2 * 11 + 2);
+    assert(huge.Get(0) == -1);
+    assert(huge.Get(1) == 0);
+    assert(huge.Get(1000000) == -1);
+    assert(huge.Get(1000001) == 2LL * 999999);
+    assert(huge.GetLast() == 2LL * (INT_MAX - 2001));
+    try
+    {
+        huge.Append(0);
+        huge.Append(0);
+        huge.InsertLSeq(&huge, 0);
+        assert(false);
+    }
+    catch (const std::length_error&) {}
+
+    //  :  Cardinal(1, 0),     
+    MixedLazySequence<int> naturals([](int i) { return i; });
+    naturals.InsertAt(-5, 3)->Prepend(-1);
+    assert(naturals.IsInfinite());
+    assert(naturals.GetLength() == Cardinal(1, 0));
+    assert(naturals.Get(0) == -1 && naturals.Get(4) == -5 && naturals.Get(5) == 3);
+    assert(naturals.Get(1000000000) == 1000000000 - 2);
+    MixedLazySequence<int>* tail = naturals.Concat(&chunk);
+    assert(tail->GetSegmentCount() == naturals.GetSegmentCount());
+    MixedLazySequence<int>* window = tail->GetSubsequence(4, 6);
+    assert(window->GetLength() == Cardinal(0, 3) && window->Get(0) == -5 && window->GetLast() == 4);
+    delete window;
+    delete tail;
+
+    try
+    {
+        chunk.Get(5);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+    try
+    {
+        chunk.InsertAt(1, 7);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+
+    //    :    0
+    MixedLazySequence<int> empty;
+    MixedLazySequence<int>* inserted = empty.InsertLSeq(&chunk, 0);
+    assert(inserted->GetLength() == Cardinal(0, 5) && inserted->Get(0) == items[0]);
+    delete inserted;
+    empty.InsertAt(5, 0);
+    assert(empty.GetLength() == Cardinal(0, 1) && empty.Get(0) == 5);
+    MixedLazySequence<int> blank;
+    try
+    {
+        blank.InsertAt(5, 1);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {}
+
+    cout << "Segmented sequence tests passed!\n";
+}
+
 void LazySequenceTests::test_all()
 {
     cout << "=== Running LazySequence Tests ===\n";
@@ -249,6 +734,12 @@ void LazySequenceTests::test_all()
     test_composition();
     test_functional_operations();    test_move_semantics();
     test_exceptions();
+    test_lazy_pipelines();
+    test_block_generation();
+    test_cache_policies();
+    test_parallel_operations();
+    test_segmented_sequences();
+    test_non_trivial_elements();
 
 
     cout << "=== All LazySequence tests passed! ===\n\n";
@@ -17,5 +17,11 @@ public:
     static void test_functional_operations();
     static void test_move_semantics();
     static void test_exceptions();
+    static void test_lazy_pipelines();
+    static void test_block_generation();
+    static void test_cache_policies();
+    static void test_parallel_operations();
+    static void test_segmented_sequences();
+    static void test_non_trivial_elements();
     static void test_all();
 };
\ No newline at end of file
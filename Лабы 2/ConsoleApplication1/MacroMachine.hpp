@@ -0,0 +1,499 @@
+#pragma once
+#include "TuringMachine.hpp"
+#include "UInt128.hpp"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>
+
+//   :    128 
+struct MacroRunResult
+{
+    RunStatus status;
+    UInt128 steps;
+    int state;
+};
+
+//   TuringMachine   (   ).
+//      blockSize    :   
+// (,  )     ,       
+//   .  (,  , ) -> ( , ,
+//  ,  )        
+// .        ,  
+//       ( ).   
+// : ,      ,    ,
+//   ,      TuringMachine::run
+template<typename T>
+class MacroMachine
+{
+public:
+    static const int MaxBlockSize = 8;
+
+    //   
+    struct Run
+    {
+        uint64_t block;
+        UInt128 count;
+    };
+
+private:
+    enum class Outcome
+    {
+        ExitLeft,
+        ExitRight,
+        Halt, //    
+        Loop, //     
+        Cut   //     
+    };
+
+    struct MacroStep
+    {
+        Outcome outcome;
+        uint64_t block;   //   
+        int state;
+        uint64_t steps;   //  Loop  ,    
+        int position;     //      Halt  Cut
+        uint64_t period;  //    Loop
+    };
+
+    //      
+    struct BlockConfig
+    {
+        uint64_t block;
+        int state;
+        int position;
+
+        bool operator==(const BlockConfig& other) const
+        {
+            return block == other.block && state == other.state && position == other.position;
+        }
+    };
+
+    struct BlockConfigHash
+    {
+        size_t operator()(const BlockConfig& config) const
+        {
+            uint64_t h = config.block * 0x9E3779B97F4A7C15ULL;
+            h ^= ((uint64_t)config.state << 8 | (uint64_t)config.position) + 0x7F4A7C159E3779B9ULL + (h << 6) + (h >> 2);
+            return (size_t)h;
+        }
+    };
+
+    //         
+    static const uint64_t LoopCheckAfter = 64;
+
+    TuringMachine<T> machine;
+    int blockSize;
+    T blank;
+    uint64_t blankBlock;
+    //  : [ * 2 + (  ? 1 : 0)][]
+    std::vector<std::unordered_map<uint64_t, MacroStep>> cache;
+
+    //   
+    std::vector<Run> left;   //     
+    std::vector<Run> right;  //     
+    int state;
+    bool facingRight;        //          
+    bool insideBlock;        //    :   
+    uint64_t headBlock;
+    int headOffset;
+    long long headPosition;  //     
+    uint64_t macroSteps;
+
+    T cell(uint64_t block, int index) const
+    {
+        return (T)(unsigned char)(block >> (8 * index));
+    }
+
+    uint64_t pack(const T* cells) const
+    {
+        uint64_t block = 0;
+        for (int i = 0; i < blockSize; ++i)
+        {
+            block |= (uint64_t)(unsigned char)cells[i] << (8 * i);
+        }
+        return block;
+    }
+
+    //    :   limit ,      
+    MacroStep simulateBlock(int current, bool fromLeft, uint64_t block, uint64_t limit, bool detectLoops) const
+    {
+        T cells[MaxBlockSize];
+        for (int i = 0; i < blockSize; ++i)
+        {
+            cells[i] = cell(block, i);
+        }
+        int position = fromLeft ? 0 : blockSize - 1;
+        std::unordered_map<BlockConfig, uint64_t, BlockConfigHash> seen;
+        uint64_t steps = 0;
+        while (true)
+        {
+            if (steps == limit)
+            {
+                return MacroStep{ Outcome::Cut, pack(cells), current, steps, position, 0 };
+            }
+            int next;
+            T write;
+            int move;
+            if (!machine.lookup(current, cells[position], next, write, move))
+            {
+                return MacroStep{ Outcome::Halt, pack(cells), current, steps, position, 0 };
+            }
+            cells[position] = write;
+            position += move;
+            current = next;
+            ++steps;
+            if (position < 0 || position >= blockSize)
+            {
+                return MacroStep{ position < 0 ? Outcome::ExitLeft : Outcome::ExitRight, pack(cells), current, steps, 0, 0 };
+            }
+            if (detectLoops && steps >= LoopCheckAfter)
+            {
+                auto inserted = seen.emplace(BlockConfig{ pack(cells), current, position }, steps);
+                if (!inserted.second)
+                {
+                    uint64_t first = inserted.first->second;
+                    return MacroStep{ Outcome::Loop, 0, current, first, 0, steps - first };
+                }
+            }
+        }
+    }
+
+    const MacroStep& macroStep(int current, bool fromLeft, uint64_t block)
+    {
+        std::unordered_map<uint64_t, MacroStep>& known = cache[current * 2 + (fromLeft ? 1 : 0)];
+        auto found = known.find(block);
+        if (found != known.end())
+        {
+            return found->second;
+        }
+        return known.emplace(block, simulateBlock(current, fromLeft, block, UINT64_MAX, true)).first->second;
+    }
+
+    void pushRun(std::vector<Run>& stack, uint64_t block, const UInt128& count)
+    {
+        if (!stack.empty() && stack.back().block == block)
+        {
+            stack.back().count += count;
+        }
+        else if (!stack.empty() || block != blankBlock)
+        {
+            //       :     
+            stack.push_back(Run{ block, count });
+        }
+    }
+
+    void popRun(std::vector<Run>& stack, const UInt128& count)
+    {
+        if (stack.empty())
+        {
+            return;
+        }
+        stack.back().count = stack.back().count - count;
+        if (stack.back().count == UInt128(0))
+        {
+            stack.pop_back();
+        }
+    }
+
+    void movePosition(bool toRight, const UInt128& cells)
+    {
+        if (!cells.fitsIn64() || cells.low > (uint64_t)LLONG_MAX - (uint64_t)(headPosition < 0 ? -headPosition : headPosition))
+        {
+            throw std::overflow_error("Head position out of range");
+        }
+        headPosition += toRight ? (long long)cells.low : -(long long)cells.low;
+    }
+
+    //    ,   ,      
+    void settleInside(const MacroStep& step)
+    {
+        if (!facingRight)
+        {
+            headPosition -= blockSize - 1;
+        }
+        headPosition += step.position;
+        insideBlock = true;
+        headBlock = step.block;
+        headOffset = step.position;
+        state = step.state;
+    }
+
+    T symbolUnderHead() const
+    {
+        if (insideBlock)
+        {
+            return cell(headBlock, headOffset);
+        }
+        if (facingRight)
+        {
+            return right.empty() ? blank : cell(right.back().block, 0);
+        }
+        return left.empty() ? blank : cell(left.back().block, blockSize - 1);
+    }
+
+    void load(const T* data, int size, int startPos)
+    {
+        left.clear();
+        right.clear();
+        state = machine.startState();
+        facingRight = true;
+        insideBlock = false;
+        headPosition = 0;
+        macroSteps = 0;
+
+        //    ,     
+        int padding = (blockSize - startPos % blockSize) % blockSize;
+        std::vector<T> cells(padding, blank);
+        cells.insert(cells.end(), data, data + size);
+        cells.resize((cells.size() + blockSize - 1) / blockSize * blockSize, blank);
+        int startBlock = (padding + startPos) / blockSize;
+        int blockCount = (int)cells.size() / blockSize;
+        for (int b = 0; b < startBlock; ++b)
+        {
+            pushRun(left, pack(cells.data() + b * blockSize), 1);
+        }
+        for (int b = blockCount - 1; b >= startBlock; --b)
+        {
+            pushRun(right, pack(cells.data() + b * blockSize), 1);
+        }
+    }
+
+    MacroRunResult execute(const UInt128& maxSteps)
+    {
+        UInt128 steps = 0;
+        while (steps < maxSteps)
+        {
+            std::vector<Run>& ahead = facingRight ? right : left;
+            uint64_t block = ahead.empty() ? blankBlock : ahead.back().block;
+            const MacroStep step = macroStep(state, facingRight, block);
+            UInt128 remaining = maxSteps - steps;
+
+            if (step.outcome == Outcome::Halt && UInt128(step.steps) <= remaining)
+            {
+                popRun(ahead, 1);
+                settleInside(step);
+                steps += step.steps;
+                ++macroSteps;
+                break;
+            }
+
+            UInt128 count = 0;
+            if (step.outcome == Outcome::ExitLeft || step.outcome == Outcome::ExitRight)
+            {
+                bool exitsRight = step.outcome == Outcome::ExitRight;
+                bool chain = step.state == state && exitsRight == facingRight;
+                UInt128 affordable = remaining / step.steps;
+                count = !chain ? UInt128(1) : ahead.empty() ? affordable : ahead.back().count;
+                if (affordable < count)
+                {
+                    count = affordable;
+                }
+                if (count != UInt128(0))
+                {
+                    popRun(ahead, count);
+                    pushRun(exitsRight ? left : right, step.block, count);
+                    if (exitsRight == facingRight)
+                    {
+                        movePosition(exitsRight, count * (uint64_t)blockSize);
+                    }
+                    else
+                    {
+                        movePosition(exitsRight, 1);
+                    }
+                    steps += count * step.steps;
+                    state = step.state;
+                    facingRight = exitsRight;
+                    ++macroSteps;
+                    continue;
+                }
+            }
+
+            //            :
+            //     (      )
+            uint64_t limit;
+            if (step.outcome == Outcome::Loop && UInt128(step.steps) + UInt128(step.period) < remaining)
+            {
+                uint64_t phase;
+                (remaining - UInt128(step.steps)).divide(step.period, phase);
+                limit = step.steps + phase;
+            }
+            else
+            {
+                limit = remaining.low;
+            }
+            popRun(ahead, 1);
+            settleInside(simulateBlock(state, facingRight, block, limit, false));
+            steps = maxSteps;
+            ++macroSteps;
+        }
+
+        int next;
+        T write;
+        int move;
+        bool halted = !machine.lookup(state, symbolUnderHead(), next, write, move);
+        return MacroRunResult{ halted ? RunStatus::Halted : RunStatus::StepLimit, steps, state };
+    }
+
+public:
+    MacroMachine(const TuringMachine<T>& compiled, int size, T blankSymbol = T())
+        : machine(compiled), blockSize(size), blank(blankSymbol), blankBlock(0),
+        cache(compiled.stateCount() * 2), state(compiled.startState()), facingRight(true),
+        insideBlock(false), headBlock(0), headOffset(0), headPosition(0), macroSteps(0)
+    {
+        if (size < 1 || size > MaxBlockSize)
+        {
+            throw std::invalid_argument("Block size must be between 1 and 8");
+        }
+        for (int i = 0; i < blockSize; ++i)
+        {
+            blankBlock |= (uint64_t)(unsigned char)blank << (8 * i);
+        }
+    }
+
+    //    ;     
+    MacroRunResult run(const UInt128& maxSteps)
+    {
+        load(nullptr, 0, 0);
+        return execute(maxSteps);
+    }
+
+    //     size  data    startPos ( Tape::initialize)
+    MacroRunResult run(const T* data, int size, int startPos, const UInt128& maxSteps)
+    {
+        if (startPos < 0 || startPos >= size)
+        {
+            throw std::out_of_range("Invalid start position");
+        }
+        load(data, size, startPos);
+        return execute(maxSteps);
+    }
+
+    int getBlockSize() const
+    {
+        return blockSize;
+    }
+
+    //        ( Tape::position)
+    long long position() const
+    {
+        return headPosition;
+    }
+
+    //     (      )
+    uint64_t lastMacroSteps() const
+    {
+        return macroSteps;
+    }
+
+    size_t cachedTransitions() const
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < cache.size(); ++i)
+        {
+            total += cache[i].size();
+        }
+        return total;
+    }
+
+    //  :   
+    std::vector<Run> getRuns() const
+    {
+        std::vector<Run> runs(left.begin(), left.end());
+        if (insideBlock)
+        {
+            runs.push_back(Run{ headBlock, 1 });
+        }
+        runs.insert(runs.end(), right.rbegin(), right.rend());
+        return runs;
+    }
+
+    //    symbol   
+    UInt128 countSymbol(T symbol) const
+    {
+        UInt128 total = 0;
+        std::vector<Run> runs = getRuns();
+        for (size_t r = 0; r < runs.size(); ++r)
+        {
+            uint64_t inBlock = 0;
+            for (int i = 0; i < blockSize; ++i)
+            {
+                inBlock += cell(runs[r].block, i) == symbol;
+            }
+            if (inBlock != 0)
+            {
+                total += runs[r].count * inBlock;
+            }
+        }
+        return total;
+    }
+
+    //    tape (    ); false,    
+    // maxCells .  tape      
+    bool expand(Tape<T>& tape, int maxCells = 1 << 26) const
+    {
+        UInt128 leftBlocks = 0;
+        UInt128 totalBlocks = insideBlock ? 1 : 0;
+        for (size_t r = 0; r < left.size(); ++r)
+        {
+            leftBlocks += left[r].count;
+        }
+        totalBlocks += leftBlocks;
+        for (size_t r = 0; r < right.size(); ++r)
+        {
+            totalBlocks += right[r].count;
+        }
+        //    ,       
+        if (totalBlocks + UInt128(1) > UInt128((uint64_t)(maxCells / blockSize)))
+        {
+            return false;
+        }
+
+        std::vector<T> cells;
+        bool padLeft = !insideBlock && !facingRight && left.empty();
+        if (padLeft)
+        {
+            cells.resize(blockSize, blank);
+        }
+        for (size_t r = 0; r < left.size(); ++r)
+        {
+            for (uint64_t c = 0; c < left[r].count.low; ++c)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    cells.push_back(cell(left[r].block, i));
+                }
+            }
+        }
+        size_t head = cells.size();
+        if (insideBlock)
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                cells.push_back(cell(headBlock, i));
+            }
+            head += headOffset;
+        }
+        else if (!facingRight)
+        {
+            --head;
+        }
+        for (size_t r = right.size(); r-- > 0;)
+        {
+            for (uint64_t c = 0; c < right[r].count.low; ++c)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    cells.push_back(cell(right[r].block, i));
+                }
+            }
+        }
+        if (head >= cells.size())
+        {
+            cells.resize(cells.size() + blockSize, blank);
+        }
+        tape.initialize(cells.data(), (int)cells.size(), (int)head);
+        return true;
+    }
+};
@@ -0,0 +1,201 @@
+#pragma once
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+#include <cstddef>
+
+//       .    
+//  ParallelChunk     ,    
+//    :      ,  
+//      
+
+//      
+enum class SumMode
+{
+    Plain,    //  
+    Kahan,    //   :     
+    Pairwise  //  () :    log n
+};
+
+const size_t ParallelChunk = 1 << 16;
+
+inline int DefaultThreadCount()
+{
+    unsigned int n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : (int)n;
+}
+
+//  [0, count)  threads     body(first, last)  ;
+//  0    . threads <= 0    .
+//         join
+template <class Body>
+void ParallelRanges(size_t count, int threads, Body body)
+{
+    if (threads <= 0)
+    {
+        threads = DefaultThreadCount();
+    }
+    threads = (int)std::min<size_t>(threads, std::max<size_t>(count, 1));
+    if (threads == 1)
+    {
+        body((size_t)0, count);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(threads);
+    auto part = [&](int t)
+        {
+            try
+            {
+                body(count * t / threads, count * (t + 1) / threads);
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (int t = 1; t < threads; ++t)
+    {
+        workers.emplace_back(part, t);
+    }
+    part(0);
+    for (size_t t = 0; t < workers.size(); ++t)
+    {
+        workers[t].join();
+    }
+    for (size_t t = 0; t < errors.size(); ++t)
+    {
+        if (errors[t])
+        {
+            std::rethrow_exception(errors[t]);
+        }
+    }
+}
+
+//    op    identity
+template <class T, class Op>
+T ParallelReduce(const T* data, size_t count, T identity, Op op, int threads = 0)
+{
+    size_t chunks = (count + ParallelChunk - 1) / ParallelChunk;
+    std::vector<T> partial(chunks, identity);
+    ParallelRanges(chunks, threads, [&](size_t first, size_t last)
+        {
+            for (size_t c = first; c < last; ++c)
+            {
+                const T* begin = data + c * ParallelChunk;
+                const T* end = data + std::min(count, (c + 1) * ParallelChunk);
+                T acc = identity;
+                for (const T* p = begin; p != end; ++p)
+                {
+                    acc = op(acc, *p);
+                }
+                partial[c] = acc;
+            }
+        });
+
+    T result = identity;
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        result = op(result, partial[c]);
+    }
+    return result;
+}
+
+template <class T>
+T KahanSum(const T* data, size_t count)
+{
+    T sum = T();
+    T compensation = T();
+    for (size_t i = 0; i < count; ++i)
+    {
+        T y = data[i] - compensation;
+        T t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
+    }
+    return sum;
+}
+
+template <class T>
+T PairwiseSum(const T* data, size_t count)
+{
+    if (count <= 128)
+    {
+        T sum = T();
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum += data[i];
+        }
+        return sum;
+    }
+    size_t half = count / 2;
+    return PairwiseSum(data, half) + PairwiseSum(data + half, count - half);
+}
+
+template <class T>
+T ParallelSum(const T* data, size_t count, SumMode mode = SumMode::Plain, int threads = 0)
+{
+    size_t chunks = (count + ParallelChunk - 1) / ParallelChunk;
+    std::vector<T> partial(chunks, T());
+    ParallelRanges(chunks, threads, [&](size_t first, size_t last)
+        {
+            for (size_t c = first; c < last; ++c)
+            {
+                const T* begin = data + c * ParallelChunk;
+                size_t size = std::min(count, (c + 1) * ParallelChunk) - c * ParallelChunk;
+                switch (mode)
+                {
+                case SumMode::Kahan:
+                    partial[c] = KahanSum(begin, size);
+                    break;
+                case SumMode::Pairwise:
+                    partial[c] = PairwiseSum(begin, size);
+                    break;
+                default:
+                {
+                    T sum = T();
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        sum += begin[i];
+                    }
+                    partial[c] = sum;
+                }
+                }
+            }
+        });
+
+    switch (mode)
+    {
+    case SumMode::Kahan:
+        return KahanSum(partial.data(), chunks);
+    case SumMode::Pairwise:
+        return PairwiseSum(partial.data(), chunks);
+    default:
+    {
+        T sum = T();
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            sum += partial[c];
+        }
+        return sum;
+    }
+    }
+}
+
+// out[i] = func(in[i]); out   count , func    
+template <class T, class R, class Func>
+void ParallelMap(const T* in, size_t count, R* out, Func func, int threads = 0)
+{
+    size_t chunks = (count + ParallelChunk - 1) / ParallelChunk;
+    ParallelRanges(chunks, threads, [&](size_t first, size_t last)
+        {
+            size_t end = std::min(count, last * ParallelChunk);
+            for (size_t i = first * ParallelChunk; i < end; ++i)
+            {
+                out[i] = func(in[i]);
+            }
+        });
+}
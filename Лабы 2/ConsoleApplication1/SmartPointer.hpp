@@ -1,83 +1,259 @@
 #pragma once
 #include <cstddef>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
-template<typename T>
+//   . AtomicRefCount   ,   
+//    :  relaxed (    
+// ),  release,      acquire,   
+//          .
+// PlainRefCount      ,   
+class AtomicRefCount
+{
+private:
+    std::atomic<size_t> value;
+
+public:
+    explicit AtomicRefCount(size_t initial = 1) : value(initial) {}
+
+    void increment()
+    {
+        value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // true,    
+    bool decrement()
+    {
+        if (value.fetch_sub(1, std::memory_order_release) == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+    // ,       (    )
+    bool incrementIfNonZero()
+    {
+        size_t current = value.load(std::memory_order_relaxed);
+        while (current != 0)
+        {
+            if (value.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t get() const
+    {
+        return value.load(std::memory_order_relaxed);
+    }
+};
+
+class PlainRefCount
+{
+private:
+    size_t value;
+
+public:
+    explicit PlainRefCount(size_t initial = 1) : value(initial) {}
+
+    void increment()
+    {
+        ++value;
+    }
+
+    bool decrement()
+    {
+        return --value == 0;
+    }
+
+    bool incrementIfNonZero()
+    {
+        if (value == 0)
+        {
+            return false;
+        }
+        ++value;
+        return true;
+    }
+
+    size_t get() const
+    {
+        return value;
+    }
+};
+
+//  :     .    
+//  ,        (     )
+template<typename Count>
+class ControlBlock
+{
+public:
+    Count strong;
+    Count weak;
+
+    ControlBlock() : strong(1), weak(1) {}
+
+    virtual ~ControlBlock() {}
+
+    //      ,   
+    virtual void dispose() = 0;
+
+    void releaseStrong()
+    {
+        if (strong.decrement())
+        {
+            dispose();
+            releaseWeak();
+        }
+    }
+
+    void releaseWeak()
+    {
+        if (weak.decrement())
+        {
+            delete this;
+        }
+    }
+};
+
+//  ( ),    new / new[]
+template<typename T, typename Count, bool IsArray>
+class PointerBlock : public ControlBlock<Count>
+{
+private:
+    T* object;
+
+public:
+    explicit PointerBlock(T* p) : object(p) {}
+
+    void dispose() override
+    {
+        if (IsArray)
+        {
+            delete[] object;  //   
+        }
+        else
+        {
+            delete object;    //   
+        }
+    }
+};
+
+//    :       
+template<typename T, typename Count>
+class InlineBlock : public ControlBlock<Count>
+{
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+public:
+    template<typename... Args>
+    explicit InlineBlock(Args&&... args)
+    {
+        new (&storage) T(std::forward<Args>(args)...);
+    }
+
+    T* get()
+    {
+        return reinterpret_cast<T*>(&storage);
+    }
+
+    void dispose() override
+    {
+        get()->~T();
+    }
+};
+
+template<typename T, typename Count>
+class WeakPointer;
+
+//      . Count   :  
+//  (     ), PlainRefCount  ,  
+//   
+template<typename T, typename Count = AtomicRefCount>
 class SmartPointer
 {
 private:
     T* ptr;
-    size_t* refCount;
+    ControlBlock<Count>* block;
     bool isArray;
 
     //      
     void addReference() 
     {
-        if (refCount) 
+        if (block) 
         {
-            (*refCount)++;
+            block->strong.increment();
         }
     }
 
     void removeReference() 
     {
-        if (refCount && --(*refCount) == 0) 
+        if (block) 
         {
-            if (isArray)
-            {
-                delete[] ptr;  //   
-            }
-            else
-            {
-                delete ptr;    //   
-            }
-            delete refCount;
+            block->releaseStrong();
             ptr = nullptr;
-            refCount = nullptr;
+            block = nullptr;
         }
     }
 
-public:
-    //    
-    explicit SmartPointer(T* p = nullptr) : ptr(p), isArray(false) 
+    //   ,  ;     ,  
+    template<bool IsArray>
+    static ControlBlock<Count>* adopt(T* p)
     {
-        if (ptr) 
+        if (!p)
         {
-            refCount = new size_t(1);
+            return nullptr;
         }
-        else 
+        try
         {
-            refCount = nullptr;
+            return new PointerBlock<T, Count, IsArray>(p);
         }
+        catch (...)
+        {
+            PointerBlock<T, Count, IsArray>(p).dispose();
+            throw;
+        }
+    }
+
+    //  make_single  WeakPointer::lock:     
+    SmartPointer(T* p, ControlBlock<Count>* b, bool array) : ptr(p), block(b), isArray(array) {}
+
+    friend class WeakPointer<T, Count>;
+
+public:
+    //    
+    explicit SmartPointer(T* p = nullptr) : ptr(p), block(adopt<false>(p)), isArray(false) 
+    {
     }
 
     //   
     class ArrayTag {};
     static constexpr ArrayTag ARRAY = ArrayTag();
 
-    SmartPointer(T* p, ArrayTag) : ptr(p), isArray(true) 
+    SmartPointer(T* p, ArrayTag) : ptr(p), block(adopt<true>(p)), isArray(true) 
     {
-        if (ptr) 
-        {
-            refCount = new size_t(1);
-        }
-        else 
-        {
-            refCount = nullptr;
-        }
     }
 
     //  
-    SmartPointer(const SmartPointer& other): ptr(other.ptr), refCount(other.refCount), isArray(other.isArray) 
+    SmartPointer(const SmartPointer& other): ptr(other.ptr), block(other.block), isArray(other.isArray) 
     {
         addReference();
     }
 
     // Move 
     SmartPointer(SmartPointer&& other) noexcept
-        : ptr(other.ptr), refCount(other.refCount), isArray(other.isArray) 
+        : ptr(other.ptr), block(other.block), isArray(other.isArray) 
     {
         other.ptr = nullptr;
-        other.refCount = nullptr;
+        other.block = nullptr;
     }
 
     //  
@@ -87,7 +263,7 @@ public:
         {
             removeReference();
             ptr = other.ptr;
-            refCount = other.refCount;
+            block = other.block;
             isArray = other.isArray;
             addReference();
         }
@@ -101,10 +277,10 @@ public:
         {
             removeReference();
             ptr = other.ptr;
-            refCount = other.refCount;
+            block = other.block;
             isArray = other.isArray;
             other.ptr = nullptr;
-            other.refCount = nullptr;
+            other.block = nullptr;
         }
         return *this;
     }
@@ -143,7 +319,7 @@ public:
     explicit operator bool() const { return ptr != nullptr; }
 
     //   
-    size_t use_count() const { return refCount ? *refCount : 0; }
+    size_t use_count() const { return block ? block->strong.get() : 0; }
 
     //      
     bool is_array() const { return isArray; }
@@ -154,15 +330,268 @@ public:
         return SmartPointer(new T[size], ARRAY);
     }
 
-    //      
-    static SmartPointer make_single() 
+    //      :       
+    template<typename... Args>
+    static SmartPointer make_single(Args&&... args) 
+    {
+        InlineBlock<T, Count>* created = new InlineBlock<T, Count>(std::forward<Args>(args)...);
+        return SmartPointer(created->get(), created, false);
+    }
+};
+
+template<typename T, typename Count>
+constexpr typename SmartPointer<T, Count>::ArrayTag SmartPointer<T, Count>::ARRAY;
+
+//     SmartPointer:    ,   
+// ,    ,   ,      lock
+template<typename T, typename Count = AtomicRefCount>
+class WeakPointer
+{
+private:
+    T* ptr;
+    ControlBlock<Count>* block;
+    bool isArray;
+
+    void addReference()
+    {
+        if (block)
+        {
+            block->weak.increment();
+        }
+    }
+
+    void removeReference()
+    {
+        if (block)
+        {
+            block->releaseWeak();
+            ptr = nullptr;
+            block = nullptr;
+        }
+    }
+
+public:
+    WeakPointer() : ptr(nullptr), block(nullptr), isArray(false) {}
+
+    WeakPointer(const SmartPointer<T, Count>& owner) : ptr(owner.ptr), block(owner.block), isArray(owner.isArray)
+    {
+        addReference();
+    }
+
+    WeakPointer(const WeakPointer& other) : ptr(other.ptr), block(other.block), isArray(other.isArray)
+    {
+        addReference();
+    }
+
+    WeakPointer(WeakPointer&& other) noexcept : ptr(other.ptr), block(other.block), isArray(other.isArray)
+    {
+        other.ptr = nullptr;
+        other.block = nullptr;
+    }
+
+    WeakPointer& operator=(const WeakPointer& other)
+    {
+        if (this != &other)
+        {
+            WeakPointer copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    WeakPointer& operator=(WeakPointer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            removeReference();
+            ptr = other.ptr;
+            block = other.block;
+            isArray = other.isArray;
+            other.ptr = nullptr;
+            other.block = nullptr;
+        }
+        return *this;
+    }
+
+    ~WeakPointer()
+    {
+        removeReference();
+    }
+
+    //    (  )
+    bool expired() const { return use_count() == 0; }
+
+    size_t use_count() const { return block ? block->strong.get() : 0; }
+
+    bool is_array() const { return isArray; }
+
+    //       ,    
+    SmartPointer<T, Count> lock() const
+    {
+        if (block && block->strong.incrementIfNonZero())
+        {
+            return SmartPointer<T, Count>(ptr, block, isArray);
+        }
+        return SmartPointer<T, Count>();
+    }
+
+    void reset()
     {
-        return SmartPointer(new T());
+        removeReference();
+    }
+};
+
+//       IntrusivePtr:   .
+//     ,    
+template<typename Count = AtomicRefCount>
+class RefCounted
+{
+private:
+    mutable Count refs;
+
+public:
+    RefCounted() : refs(0) {}
+
+    RefCounted(const RefCounted&) : refs(0) {}
+
+    RefCounted& operator=(const RefCounted&) { return *this; }
+
+    void addReference() const { refs.increment(); }
+
+    // true,    
+    bool removeReference() const { return refs.decrement(); }
+
+    size_t referenceCount() const { return refs.get(); }
+
+protected:
+    ~RefCounted() {}
+};
+
+//       (T  RefCounted    
+// addReference/removeReference/referenceCount).    : 
+//            .
+//              
+// IntrusivePtr.      
+template<typename T>
+class IntrusivePtr
+{
+private:
+    T* ptr;
+    bool isArray;
+
+    void addReference()
+    {
+        if (ptr)
+        {
+            ptr->addReference();
+        }
+    }
+
+    void removeReference()
+    {
+        if (ptr && ptr->removeReference())
+        {
+            if (isArray)
+            {
+                delete[] ptr;
+            }
+            else
+            {
+                delete ptr;
+            }
+        }
+        ptr = nullptr;
+    }
+
+public:
+    explicit IntrusivePtr(T* p = nullptr) : ptr(p), isArray(false)
+    {
+        addReference();
+    }
+
+    typedef typename SmartPointer<T>::ArrayTag ArrayTag;
+    static constexpr ArrayTag ARRAY = ArrayTag();
+
+    IntrusivePtr(T* p, ArrayTag) : ptr(p), isArray(true)
+    {
+        addReference();
+    }
+
+    IntrusivePtr(const IntrusivePtr& other) : ptr(other.ptr), isArray(other.isArray)
+    {
+        addReference();
+    }
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept : ptr(other.ptr), isArray(other.isArray)
+    {
+        other.ptr = nullptr;
+    }
+
+    IntrusivePtr& operator=(const IntrusivePtr& other)
+    {
+        if (this != &other)
+        {
+            IntrusivePtr copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept
+    {
+        if (this != &other)
+        {
+            removeReference();
+            ptr = other.ptr;
+            isArray = other.isArray;
+            other.ptr = nullptr;
+        }
+        return *this;
+    }
+
+    ~IntrusivePtr()
+    {
+        removeReference();
+    }
+
+    T& operator*() const
+    {
+        if (!ptr) throw std::runtime_error("Dereferencing null pointer");
+        return *ptr;
+    }
+
+    T* operator->() const
+    {
+        if (!ptr) throw std::runtime_error("Accessing null pointer");
+        return ptr;
+    }
+
+    T& operator[](size_t index) const
+    {
+        if (!ptr) throw std::runtime_error("Accessing null array");
+        if (!isArray) throw std::runtime_error("Not an array pointer");
+        return ptr[index];
+    }
+
+    T* get() const { return ptr; }
+
+    explicit operator bool() const { return ptr != nullptr; }
+
+    size_t use_count() const { return ptr ? ptr->referenceCount() : 0; }
+
+    bool is_array() const { return isArray; }
+
+    static IntrusivePtr make_array(size_t size)
+    {
+        return IntrusivePtr(new T[size], ARRAY);
     }
 
     template<typename... Args>
-    static SmartPointer make_single(Args&&... args) 
+    static IntrusivePtr make_single(Args&&... args)
     {
-        return SmartPointer(new T(std::forward<Args>(args)...));
+        return IntrusivePtr(new T(std::forward<Args>(args)...));
     }
-};
\ No newline at end of file
+};
+
+template<typename T>
+constexpr typename IntrusivePtr<T>::ArrayTag IntrusivePtr<T>::ARRAY;
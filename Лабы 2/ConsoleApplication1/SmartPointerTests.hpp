@@ -3,6 +3,8 @@
 #include <iostream>
 #include <cassert>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 //     /
 class TrackedObject 
@@ -25,6 +27,19 @@ public:
 int TrackedObject::constructorCount = 0;
 int TrackedObject::destructorCount = 0;
 
+//    IntrusivePtr:    
+class IntrusiveObject : public RefCounted<>
+{
+public:
+    static int destructorCount;
+    int value;
+
+    IntrusiveObject(int v = 0) : value(v) {}
+    ~IntrusiveObject() { destructorCount++; }
+};
+
+int IntrusiveObject::destructorCount = 0;
+
 class SmartPointerTests
 {
 public:
@@ -283,6 +298,207 @@ public:
         std::cout << "Factory method tests passed!\n";
     }
 
+    static void test_single_allocation()
+    {
+        std::cout << "Testing single allocation and refcount policies...\n";
+
+        TrackedObject::resetCounters();
+        {
+            auto ptr1 = SmartPointer<TrackedObject>::make_single(7);
+            SmartPointer<TrackedObject> ptr2 = ptr1;
+            assert(ptr1.use_count() == 2);
+            assert(ptr2->value == 7);
+            assert(!ptr1.is_array());
+            ptr1 = SmartPointer<TrackedObject>();
+            assert(ptr2.use_count() == 1);
+            assert(TrackedObject::destructorCount == 0);
+        }
+        assert(TrackedObject::constructorCount == 1);
+        assert(TrackedObject::destructorCount == 1);
+
+        //         
+        struct Throwing
+        {
+            Throwing() { throw std::runtime_error("constructor failed"); }
+        };
+        try
+        {
+            SmartPointer<Throwing>::make_single();
+            assert(false);
+        }
+        catch (const std::runtime_error&) {}
+
+        //  :      
+        TrackedObject::resetCounters();
+        {
+            auto local = SmartPointer<TrackedObject, PlainRefCount>::make_single(3);
+            SmartPointer<TrackedObject, PlainRefCount> copy = local;
+            SmartPointer<TrackedObject, PlainRefCount> separate(new TrackedObject(4));
+            assert(local.use_count() == 2);
+            copy = separate;
+            assert(local.use_count() == 1);
+            assert(separate.use_count() == 2);
+            SmartPointer<int, PlainRefCount> arr(new int[3], SmartPointer<int, PlainRefCount>::ARRAY);
+            arr[2] = 5;
+            assert(arr[2] == 5);
+        }
+        assert(TrackedObject::destructorCount == 2);
+
+        std::cout << "Single allocation tests passed!\n";
+    }
+
+    static void test_threads()
+    {
+        std::cout << "Testing shared pointer across threads...\n";
+
+        TrackedObject::resetCounters();
+        {
+            auto shared = SmartPointer<TrackedObject>::make_single(1);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([shared]()
+                    {
+                        std::vector<SmartPointer<TrackedObject>> copies;
+                        for (int i = 0; i < 10000; ++i)
+                        {
+                            copies.push_back(shared);
+                            if (copies.size() == 100)
+                            {
+                                copies.clear();
+                            }
+                        }
+                    });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            assert(shared.use_count() == 1);
+            assert(TrackedObject::destructorCount == 0);
+        }
+        assert(TrackedObject::destructorCount == 1);
+
+        std::cout << "Thread tests passed!\n";
+    }
+
+    static void test_weak_pointers()
+    {
+        std::cout << "Testing weak pointers...\n";
+
+        TrackedObject::resetCounters();
+        WeakPointer<TrackedObject> weak;
+        assert(weak.expired());
+        assert(!weak.lock());
+        {
+            auto owner = SmartPointer<TrackedObject>::make_single(11);
+            weak = owner;
+            WeakPointer<TrackedObject> copy = weak;
+            assert(!weak.expired());
+            assert(weak.use_count() == 1);
+
+            SmartPointer<TrackedObject> locked = copy.lock();
+            assert(locked && locked->value == 11);
+            assert(owner.use_count() == 2);
+        }
+        //  ,     
+        assert(TrackedObject::destructorCount == 1);
+        assert(weak.expired());
+        assert(!weak.lock());
+        weak.reset();
+
+        //   ARRAY:     
+        {
+            SmartPointer<int> arr(new int[4], SmartPointer<int>::ARRAY);
+            arr[3] = 9;
+            WeakPointer<int> weakArray = arr;
+            assert(weakArray.is_array());
+            SmartPointer<int> again = weakArray.lock();
+            assert(again.is_array() && again[3] == 9);
+        }
+
+        //  
+        {
+            SmartPointer<TrackedObject, PlainRefCount> local(new TrackedObject(2));
+            WeakPointer<TrackedObject, PlainRefCount> weakLocal = local;
+            local = SmartPointer<TrackedObject, PlainRefCount>();
+            assert(weakLocal.expired());
+        }
+
+        // lock   ,      
+        for (int round = 0; round < 20; ++round)
+        {
+            auto owner = SmartPointer<TrackedObject>::make_single(round);
+            WeakPointer<TrackedObject> shared = owner;
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 3; ++t)
+            {
+                threads.emplace_back([shared, round]()
+                    {
+                        for (int i = 0; i < 1000; ++i)
+                        {
+                            SmartPointer<TrackedObject> locked = shared.lock();
+                            assert(!locked || locked->value == round);
+                        }
+                    });
+            }
+            owner = SmartPointer<TrackedObject>();
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+            assert(shared.expired());
+        }
+
+        std::cout << "Weak pointer tests passed!\n";
+    }
+
+    static void test_intrusive_pointers()
+    {
+        std::cout << "Testing intrusive pointers...\n";
+
+        IntrusiveObject::destructorCount = 0;
+        {
+            auto ptr1 = IntrusivePtr<IntrusiveObject>::make_single(5);
+            assert(ptr1.use_count() == 1);
+            IntrusivePtr<IntrusiveObject> ptr2 = ptr1;
+            assert(ptr1.use_count() == 2);
+
+            //              
+            IntrusivePtr<IntrusiveObject> ptr3(ptr1.get());
+            assert(ptr1.use_count() == 3);
+            ptr2 = std::move(ptr3);
+            assert(ptr1.use_count() == 2);
+            assert(ptr2->value == 5);
+
+            //     
+            IntrusivePtr<IntrusiveObject> clone = IntrusivePtr<IntrusiveObject>::make_single(*ptr1);
+            assert(clone.use_count() == 1 && clone->value == 5);
+            assert(IntrusiveObject::destructorCount == 0);
+        }
+        assert(IntrusiveObject::destructorCount == 2);
+
+        {
+            IntrusivePtr<IntrusiveObject> arr = IntrusivePtr<IntrusiveObject>::make_array(3);
+            IntrusivePtr<IntrusiveObject> copy = arr;
+            assert(arr.is_array() && arr.use_count() == 2);
+            copy[2].value = 8;
+            assert(arr[2].value == 8);
+        }
+        assert(IntrusiveObject::destructorCount == 5);
+
+        IntrusivePtr<IntrusiveObject> empty;
+        assert(!empty && empty.use_count() == 0);
+        try
+        {
+            *empty;
+            assert(false);
+        }
+        catch (const std::runtime_error&) {}
+
+        std::cout << "Intrusive pointer tests passed!\n";
+    }
+
     static void test_all() 
     {
         std::cout << "=== Running SmartPointer Tests ===\n";
@@ -295,6 +511,10 @@ public:
         test_access_operators();
         test_exceptions();
         test_factory_methods();
+        test_single_allocation();
+        test_threads();
+        test_weak_pointers();
+        test_intrusive_pointers();
 
         std::cout << "=== All SmartPointer tests passed! ===\n\n";
     }
@@ -1,18 +1,55 @@
 #pragma once
-#include "LazySequence.hpp"
+#include "DynamicArray.hpp"
 #include <stdexcept>
+#include <algorithm>
 
+//   :   ,      
+// (,    ). ,      O(1),
+//   O(1) 
 template<typename T>
 class Tape
 {
 private:
-    LazySequence<T> right;
-    LazySequence<T> left;
-    T current;
+    DynamicArray<T> cells;
+    size_t head;    //      cells
+    size_t lowest;  //  : [lowest, highest]
+    size_t highest;
+    size_t start;   //   
     T blankSymbol;
 
+    //   count  
+    static DynamicArray<T> blankCells(size_t count, T blank)
+    {
+        DynamicArray<T> result(count);
+        std::fill_n(result.reserve_back(count), count, blank);
+        result.commit_back(count);
+        return result;
+    }
+
+    //      ,   
+    void growRight()
+    {
+        size_t extra = std::max<size_t>(cells.get_size(), 16);
+        std::fill_n(cells.reserve_back(extra), extra, blankSymbol);
+        cells.commit_back(extra);
+    }
+
+    //      ,   ;  
+    void growLeft()
+    {
+        size_t size = cells.get_size();
+        size_t extra = std::max<size_t>(size, 16);
+        DynamicArray<T> grown = blankCells(size + extra, blankSymbol);
+        std::copy(cells.get_data(), cells.get_data() + size, grown.get_data() + extra);
+        cells.swap(grown);
+        head += extra;
+        lowest += extra;
+        highest += extra;
+        start += extra;
+    }
+
 public:
-    explicit Tape(T blank = T()) : blankSymbol(blank), current(blank)
+    explicit Tape(T blank = T()) : cells(blankCells(1, blank)), head(0), lowest(0), highest(0), start(0), blankSymbol(blank)
     {
     }
 
@@ -23,150 +60,79 @@ public:
             throw std::out_of_range("Invalid start position");
         }
 
-        current = data[startPos];
-
-        //  
-        if (startPos + 1 < size)
-        {
-            T* rightData = new T[size - startPos - 1];
-            for (int i = 0; i < size - startPos - 1; ++i)
-            {
-                rightData[i] = data[startPos + 1 + i];
-            }
-            right = LazySequence<T>(rightData, size - startPos - 1);
-            delete[] rightData;
-        }
-        else
-        {
-            right = LazySequence<T>();
-        }
+        DynamicArray<T> loaded(size);
+        std::copy(data, data + size, loaded.reserve_back(size));
+        loaded.commit_back(size);
+        cells.swap(loaded);
+        head = startPos;
+        lowest = 0;
+        highest = size - 1;
+        start = startPos;
+    }
 
-        //  
-        if (startPos > 0)
-        {
-            T* leftData = new T[startPos];
-            for (int i = 0; i < startPos; ++i)
-            {
-                leftData[i] = data[startPos - 1 - i];
-            }
-            left = LazySequence<T>(leftData, startPos);
-            delete[] leftData;
-        }
-        else
-        {
-            left = LazySequence<T>();
-        }
+    //    ,     .   , 
+    //          
+    void clear()
+    {
+        std::fill(cells.get_data() + lowest, cells.get_data() + highest + 1, blankSymbol);
+        head = cells.get_size() / 2;
+        lowest = head;
+        highest = head;
+        start = head;
     }
 
     T read() const
     {
-        return current;
+        return cells.get_data()[head];
     }
 
     void write(T symbol)
     {
-        current = symbol;
+        cells.get_data()[head] = symbol;
     }
 
     void moveRight()
     {
-        //      
-        T leftItem[1] = { current };
-        LazySequence<T> newLeftPart(leftItem, 1);
-
-        if (left.GetLength().index > 0)
-        {
-            LazySequence<T>* concatResult = newLeftPart.Concat(&left);
-            left = *concatResult;
-            delete concatResult;
-        }
-        else
+        if (++head == cells.get_size())
         {
-            left = newLeftPart;
-        }
-
-        //      
-        if (right.GetLength().index > 0)
-        {
-            current = right.GetFirst();
-            if (right.GetLength().index > 1)
-            {
-                LazySequence<T>* sub = right.GetSubsequence(1, right.GetLength().index - 1);
-                right = *sub;
-                delete sub;
-            }
-            else
-            {
-                right = LazySequence<T>();
-            }
-        }
-        else
-        {
-            current = blankSymbol;
+            growRight();
         }
+        highest = std::max(highest, head);
     }
 
     void moveLeft()
     {
-        //      
-        T rightItem[1] = { current };
-        LazySequence<T> newRightPart(rightItem, 1);
-
-        if (right.GetLength().index > 0)
+        if (head == 0)
         {
-            LazySequence<T>* concatResult = newRightPart.Concat(&right);
-            right = *concatResult;
-            delete concatResult;
-        }
-        else
-        {
-            right = newRightPart;
+            growLeft();
         }
+        --head;
+        lowest = std::min(lowest, head);
+    }
 
-        //      
-        if (left.GetLength().index > 0)
-        {
-            current = left.GetFirst();
-            if (left.GetLength().index > 1)
-            {
-                LazySequence<T>* sub = left.GetSubsequence(1, left.GetLength().index - 1);
-                left = *sub;
-                delete sub;
-            }
-            else
-            {
-                left = LazySequence<T>();
-            }
-        }
-        else
-        {
-            current = blankSymbol;
-        }
+    //       
+    long long position() const
+    {
+        return (long long)head - (long long)start;
     }
 
+    //     ; output   new[]
     void getContents(T*& output, int& size) const
     {
-        int leftSize = left.GetLength().index;
-        int rightSize = right.GetLength().index;
-        size = leftSize + 1 + rightSize;
-
+        size = (int)(highest - lowest + 1);
         output = new T[size];
+        std::copy(cells.get_data() + lowest, cells.get_data() + highest + 1, output);
+    }
 
-        for (int i = 0; i < leftSize; ++i)
-        {
-            output[leftSize - 1 - i] = left.Get(i);
-        }
-
-        output[leftSize] = current;
-
-        for (int i = 0; i < rightSize; ++i)
-        {
-            output[leftSize + 1 + i] = right.Get(i);
-        }
+    //     ;     
+    const T* contents(int& size) const
+    {
+        size = (int)(highest - lowest + 1);
+        return cells.get_data() + lowest;
     }
 
     T getBlankSymbol() const
     {
         return blankSymbol;
     }
-};
\ No newline at end of file
+};
@@ -47,11 +47,67 @@ public:
         std::cout << "Tape edge tests passed!\n";
     }
 
+    static void test_tape_growth()
+    {
+        std::cout << "Testing tape growth...\n";
+
+        //       :    
+        Tape<int> tape(0);
+        int test[] = { 1, 2, 3 };
+        tape.initialize(test, 3, 1);
+        for (int i = 0; i < 100000; ++i)
+        {
+            tape.moveRight();
+        }
+        assert(tape.read() == 0);
+        assert(tape.position() == 100000);
+        tape.write(7);
+        for (int i = 0; i < 300000; ++i)
+        {
+            tape.moveLeft();
+        }
+        assert(tape.position() == -200000);
+        tape.write(5);
+
+        int* contents = nullptr;
+        int size = 0;
+        tape.getContents(contents, size);
+        assert(size == 300001);
+        assert(contents[0] == 5);
+        assert(contents[199999] == 1);
+        assert(contents[200000] == 2);
+        assert(contents[200001] == 3);
+        assert(contents[size - 1] == 7);
+        delete[] contents;
+
+        //       
+        for (int i = 0; i < 200000; ++i)
+        {
+            tape.moveRight();
+        }
+        assert(tape.read() == 2);
+
+        //   initialize:   
+        Tape<char> blank('_');
+        blank.moveLeft();
+        blank.write('L');
+        blank.moveRight();
+        blank.moveRight();
+        blank.write('R');
+        char* cells = nullptr;
+        blank.getContents(cells, size);
+        assert(size == 3 && cells[0] == 'L' && cells[1] == '_' && cells[2] == 'R');
+        delete[] cells;
+
+        std::cout << "Tape growth tests passed!\n";
+    }
+
     static void test_all() 
     {
         std::cout << "=== Running Tape Tests ===\n";
         test_tape_basic();
         test_tape_edges();
+        test_tape_growth();
         std::cout << "=== All Tape tests passed! ===\n\n";
     }
 };
\ No newline at end of file
@@ -0,0 +1,257 @@
+#pragma once
+#include "Tape.hpp"
+#include "Transition.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
+#include <climits>
+
+enum class RunStatus
+{
+    Halted,   //       
+    StepLimit //   
+};
+
+struct RunResult
+{
+    RunStatus status;
+    unsigned long long steps;
+    int state; //  ,     (TuringMachine::stateName)
+};
+
+//    ,     [][].
+//       ;     ,
+//    ,      .
+//    ,  T     (char  ..)
+template<typename T>
+class TuringMachine
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) == 1, "TuringMachine requires a one-byte symbol type");
+
+public:
+    static const int SymbolCount = 256;
+
+private:
+    // next         -1,   
+    struct Entry
+    {
+        int next;
+        T write;
+        signed char move;
+    };
+
+    std::vector<Entry> table;
+    std::vector<std::string> stateNames;
+    int startRow;
+
+    static int column(T symbol)
+    {
+        return (unsigned char)symbol;
+    }
+
+    int internState(std::unordered_map<std::string, int>& ids, const std::string& name)
+    {
+        auto found = ids.find(name);
+        if (found != ids.end())
+        {
+            return found->second;
+        }
+        int id = (int)stateNames.size();
+        ids.emplace(name, id);
+        stateNames.push_back(name);
+        return id;
+    }
+
+public:
+    TuringMachine(const std::vector<Transition<T>>& transitions, const std::string& startState)
+    {
+        std::unordered_map<std::string, int> ids;
+        int start = internState(ids, startState);
+        for (size_t i = 0; i < transitions.size(); ++i)
+        {
+            internState(ids, transitions[i].getCurrentState());
+            internState(ids, transitions[i].getNextState());
+        }
+        if ((long long)stateNames.size() * SymbolCount > INT_MAX)
+        {
+            throw std::length_error("Too many states");
+        }
+
+        Entry none = { -1, T(), 0 };
+        table.assign(stateNames.size() * SymbolCount, none);
+        for (size_t i = 0; i < transitions.size(); ++i)
+        {
+            const Transition<T>& t = transitions[i];
+            Entry& entry = table[ids[t.getCurrentState()] * SymbolCount + column(t.getReadSymbol())];
+            if (entry.next != -1)
+            {
+                throw std::invalid_argument("Duplicate transition for state " + t.getCurrentState());
+            }
+            entry.next = ids[t.getNextState()] * SymbolCount;
+            entry.write = t.getWriteSymbol();
+            entry.move = (signed char)t.getMoveDirection();
+        }
+        startRow = start * SymbolCount;
+    }
+
+    int stateCount() const
+    {
+        return (int)stateNames.size();
+    }
+
+    const std::string& stateName(int state) const
+    {
+        return stateNames.at(state);
+    }
+
+    int startState() const
+    {
+        return startRow / SymbolCount;
+    }
+
+    //   state  symbol; false,    . move: -1, 0  1
+    bool lookup(int state, T symbol, int& next, T& write, int& move) const
+    {
+        const Entry& entry = table[state * SymbolCount + column(symbol)];
+        if (entry.next < 0)
+        {
+            return false;
+        }
+        next = entry.next / SymbolCount;
+        write = entry.write;
+        move = entry.move;
+        return true;
+    }
+
+    //   maxSteps       tape
+    RunResult run(Tape<T>& tape, unsigned long long maxSteps) const
+    {
+        return runFrom(tape, startState(), maxSteps);
+    }
+
+    RunResult runFrom(Tape<T>& tape, int state, unsigned long long maxSteps) const
+    {
+        if (state < 0 || state >= stateCount())
+        {
+            throw std::out_of_range("Invalid state");
+        }
+        const Entry* rows = table.data();
+        int row = state * SymbolCount;
+        unsigned long long steps = 0;
+        while (steps < maxSteps)
+        {
+            const Entry& entry = rows[row + column(tape.read())];
+            if (entry.next < 0)
+            {
+                return RunResult{ RunStatus::Halted, steps, row / SymbolCount };
+            }
+            tape.write(entry.write);
+            if (entry.move > 0)
+            {
+                tape.moveRight();
+            }
+            else if (entry.move < 0)
+            {
+                tape.moveLeft();
+            }
+            row = entry.next;
+            ++steps;
+        }
+        RunStatus status = rows[row + column(tape.read())].next < 0 ? RunStatus::Halted : RunStatus::StepLimit;
+        return RunResult{ status, steps, row / SymbolCount };
+    }
+};
+
+//      busy beaver: "1RB1LB_1LA1RZ"    
+// A, B, ...,     (,  L/R/S,  )  
+// '0', '1', ...; "---"    .   "A",   '0'
+inline std::vector<Transition<char>> ParseStandardMachine(const std::string& text)
+{
+    std::vector<Transition<char>> transitions;
+    size_t groupStart = 0;
+    int state = 0;
+    while (groupStart <= text.size())
+    {
+        size_t groupEnd = text.find('_', groupStart);
+        if (groupEnd == std::string::npos)
+        {
+            groupEnd = text.size();
+        }
+        if ((groupEnd - groupStart) % 3 != 0 || groupEnd == groupStart || state >= 26)
+        {
+            throw std::invalid_argument("Malformed machine: " + text);
+        }
+        std::string name(1, (char)('A' + state));
+        for (size_t pos = groupStart; pos < groupEnd; pos += 3)
+        {
+            char read = (char)('0' + (pos - groupStart) / 3);
+            if (text.compare(pos, 3, "---") == 0)
+            {
+                continue;
+            }
+            char write = text[pos];
+            char move = text[pos + 1];
+            char next = text[pos + 2];
+            if (write < '0' || write > '9' || (move != 'L' && move != 'R' && move != 'S') || next < 'A' || next > 'Z')
+            {
+                throw std::invalid_argument("Malformed machine: " + text);
+            }
+            Direction direction = move == 'L' ? Direction::LEFT : move == 'R' ? Direction::RIGHT : Direction::STAY;
+            transitions.push_back(Transition<char>(name, read, std::string(1, next), write, direction));
+        }
+        ++state;
+        groupStart = groupEnd + 1;
+    }
+    return transitions;
+}
+
+//    states   symbols    :   
+//  ,  L/R     states    Z.
+//  (symbols * 2 * (states + 1)) ^ (states * symbols),       
+inline std::vector<std::string> AllStandardMachines(int states, int symbols)
+{
+    if (states < 1 || states > 25 || symbols < 1 || symbols > 10)
+    {
+        throw std::invalid_argument("Invalid machine family");
+    }
+    std::vector<std::string> options;
+    for (int write = 0; write < symbols; ++write)
+    {
+        for (char move : { 'L', 'R' })
+        {
+            for (int next = 0; next <= states; ++next)
+            {
+                options.push_back(std::string{ (char)('0' + write), move, next == states ? 'Z' : (char)('A' + next) });
+            }
+        }
+    }
+
+    int cellCount = states * symbols;
+    std::vector<size_t> choice(cellCount, 0);
+    std::vector<std::string> machines;
+    while (true)
+    {
+        std::string text;
+        for (int cell = 0; cell < cellCount; ++cell)
+        {
+            if (cell > 0 && cell % symbols == 0)
+            {
+                text += '_';
+            }
+            text += options[choice[cell]];
+        }
+        machines.push_back(text);
+
+        int cell = cellCount - 1;
+        while (cell >= 0 && ++choice[cell] == options.size())
+        {
+            choice[cell--] = 0;
+        }
+        if (cell < 0)
+        {
+            return machines;
+        }
+    }
+}
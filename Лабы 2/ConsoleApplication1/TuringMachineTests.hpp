@@ -0,0 +1,328 @@
+#pragma once
+#include "TuringMachine.hpp"
+#include "MacroMachine.hpp"
+#include "BatchRunner.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+
+class TuringMachineTests
+{
+public:
+    static int count_symbol(const Tape<char>& tape, char symbol)
+    {
+        char* cells = nullptr;
+        int size = 0;
+        tape.getContents(cells, size);
+        int count = 0;
+        for (int i = 0; i < size; ++i)
+        {
+            count += cells[i] == symbol;
+        }
+        delete[] cells;
+        return count;
+    }
+
+    static void test_busy_beavers()
+    {
+        std::cout << "Testing busy beaver champions...\n";
+
+        struct Champion
+        {
+            const char* machine;
+            unsigned long long steps;
+            int ones;
+        };
+        const Champion champions[] = {
+            { "1RB1LB_1LA1RZ", 6, 4 },
+            { "1RB1RZ_1LB0RC_1LC1LA", 21, 5 },
+            { "1RB1LB_1LA0LC_1RZ1LD_1RD0RA", 107, 13 }
+        };
+        for (const Champion& champion : champions)
+        {
+            TuringMachine<char> machine(ParseStandardMachine(champion.machine), "A");
+            Tape<char> tape('0');
+            RunResult result = machine.run(tape, 1000);
+            assert(result.status == RunStatus::Halted);
+            assert(result.steps == champion.steps);
+            assert(machine.stateName(result.state) == "Z");
+            assert(count_symbol(tape, '1') == champion.ones);
+        }
+
+        std::cout << "Busy beaver tests passed!\n";
+    }
+
+    static void test_machine_on_input()
+    {
+        std::cout << "Testing machine on input...\n";
+
+        //  :     ,    
+        std::vector<Transition<char>> increment = {
+            Transition<char>("right", '0', "right", '0', Direction::RIGHT),
+            Transition<char>("right", '1', "right", '1', Direction::RIGHT),
+            Transition<char>("right", '_', "carry", '_', Direction::LEFT),
+            Transition<char>("carry", '1', "carry", '0', Direction::LEFT),
+            Transition<char>("carry", '0', "done", '1', Direction::STAY),
+            Transition<char>("carry", '_', "done", '1', Direction::STAY)
+        };
+        TuringMachine<char> machine(increment, "right");
+        assert(machine.stateCount() == 3);
+
+        Tape<char> tape('_');
+        const char number[] = { '1', '0', '1', '1' };
+        tape.initialize(number, 4, 0);
+        RunResult result = machine.run(tape, 100);
+        assert(result.status == RunStatus::Halted);
+        assert(machine.stateName(result.state) == "done");
+
+        char* cells = nullptr;
+        int size = 0;
+        tape.getContents(cells, size);
+        assert(std::string(cells, size) == "1100_");
+        delete[] cells;
+
+        //    :   
+        Tape<char> ones('_');
+        const char allOnes[] = { '1', '1', '1' };
+        ones.initialize(allOnes, 3, 0);
+        machine.run(ones, 100);
+        ones.getContents(cells, size);
+        assert(std::string(cells, size) == "1000_");
+        delete[] cells;
+
+        std::cout << "Machine on input tests passed!\n";
+    }
+
+    static void test_limits_and_errors()
+    {
+        std::cout << "Testing step limit and errors...\n";
+
+        //       
+        TuringMachine<char> runner(ParseStandardMachine("1RA"), "A");
+        Tape<char> tape('0');
+        RunResult result = runner.run(tape, 12345);
+        assert(result.status == RunStatus::StepLimit);
+        assert(result.steps == 12345);
+        assert(tape.position() == 12345);
+
+        try
+        {
+            std::vector<Transition<char>> duplicate = {
+                Transition<char>("A", '0', "B", '1', Direction::RIGHT),
+                Transition<char>("A", '0', "A", '0', Direction::LEFT)
+            };
+            TuringMachine<char> bad(duplicate, "A");
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {}
+
+        try
+        {
+            ParseStandardMachine("1RB1L");
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {}
+
+        std::cout << "Step limit and error tests passed!\n";
+    }
+
+    //        
+    static std::string trimmed_contents(const Tape<char>& tape)
+    {
+        char* cells = nullptr;
+        int size = 0;
+        tape.getContents(cells, size);
+        std::string text(cells, size);
+        delete[] cells;
+        size_t first = text.find_first_not_of(tape.getBlankSymbol());
+        if (first == std::string::npos)
+        {
+            return "";
+        }
+        return text.substr(first, text.find_last_not_of(tape.getBlankSymbol()) - first + 1);
+    }
+
+    //     : , , ,   
+    static void check_macro_matches(const TuringMachine<char>& machine, char blank, const std::string& input,
+        int startPos, unsigned long long maxSteps, int blockSize)
+    {
+        Tape<char> plainTape(blank);
+        if (!input.empty())
+        {
+            plainTape.initialize(input.data(), (int)input.size(), startPos);
+        }
+        RunResult plain = machine.run(plainTape, maxSteps);
+
+        MacroMachine<char> macro(machine, blockSize, blank);
+        MacroRunResult result = input.empty() ? macro.run(maxSteps)
+            : macro.run(input.data(), (int)input.size(), startPos, maxSteps);
+        assert(result.status == plain.status);
+        assert(result.steps == UInt128(plain.steps));
+        assert(result.state == plain.state);
+        assert(macro.position() == plainTape.position());
+
+        Tape<char> macroTape(blank);
+        assert(macro.expand(macroTape));
+        assert(macroTape.read() == plainTape.read());
+        assert(trimmed_contents(macroTape) == trimmed_contents(plainTape));
+        assert(macro.countSymbol('1') == UInt128((uint64_t)count_symbol(plainTape, '1')));
+    }
+
+    static void test_macro_machine()
+    {
+        std::cout << "Testing macro-step simulator...\n";
+
+        const char* machines[] = {
+            "1RB1LB_1LA1RZ",
+            "1RB1RZ_1LB0RC_1LC1LA",
+            "1RB1LB_1LA0LC_1RZ1LD_1RD0RA",
+            "1RB1LC_1RC1RB_1RD0LE_1LA1LD_1RZ0LA"
+        };
+        //          ,     
+        const unsigned long long budgets[] = { 1000000, 0, 1, 5, 17, 100, 1001, 4097 };
+        for (const char* text : machines)
+        {
+            TuringMachine<char> machine(ParseStandardMachine(text), "A");
+            for (int blockSize = 1; blockSize <= MacroMachine<char>::MaxBlockSize; ++blockSize)
+            {
+                for (unsigned long long budget : budgets)
+                {
+                    check_macro_matches(machine, '0', "", 0, budget, blockSize);
+                }
+            }
+        }
+
+        //  BB(5)  :   ,  
+        TuringMachine<char> champion(ParseStandardMachine(machines[3]), "A");
+        MacroMachine<char> macro(champion, 3, '0');
+        MacroRunResult result = macro.run(100000000ULL);
+        assert(result.status == RunStatus::Halted);
+        assert(result.steps == UInt128(47176870));
+        assert(champion.stateName(result.state) == "Z");
+        assert(macro.countSymbol('1') == UInt128(4098));
+        assert(macro.lastMacroSteps() * 10 < 47176870ULL);
+
+        //         '_'
+        std::vector<Transition<char>> increment = {
+            Transition<char>("right", '0', "right", '0', Direction::RIGHT),
+            Transition<char>("right", '1', "right", '1', Direction::RIGHT),
+            Transition<char>("right", '_', "carry", '_', Direction::LEFT),
+            Transition<char>("carry", '1', "carry", '0', Direction::LEFT),
+            Transition<char>("carry", '0', "done", '1', Direction::STAY),
+            Transition<char>("carry", '_', "done", '1', Direction::STAY)
+        };
+        TuringMachine<char> adder(increment, "right");
+        for (int blockSize = 1; blockSize <= 4; ++blockSize)
+        {
+            check_macro_matches(adder, '_', "1011", 0, 100, blockSize);
+            check_macro_matches(adder, '_', "_1111111", 1, 100, blockSize);
+            check_macro_matches(adder, '_', "0111", 3, 3, blockSize);
+        }
+
+        //    64 :        ,
+        //         
+        TuringMachine<char> runner(ParseStandardMachine("1RA"), "A");
+        MacroMachine<char> sweep(runner, 4, '0');
+        result = sweep.run(UInt128(1000000000000000000ULL));
+        assert(result.status == RunStatus::StepLimit);
+        assert(result.steps == UInt128(1000000000000000000ULL));
+        assert(sweep.position() == 1000000000000000000LL);
+        assert(sweep.countSymbol('1') == UInt128(1000000000000000000ULL));
+
+        TuringMachine<char> swing(ParseStandardMachine("1RB1RB_1LA1LA"), "A");
+        check_macro_matches(swing, '0', "", 0, 1001, 2);
+        MacroMachine<char> loop(swing, 2, '0');
+        UInt128 huge = UInt128(5, 1);
+        result = loop.run(huge);
+        assert(result.status == RunStatus::StepLimit);
+        assert(result.steps == huge);
+        assert(loop.position() == 1);
+        assert(result.steps.toString() == "92233720368547758081");
+
+        try
+        {
+            MacroMachine<char> bad(runner, 9, '0');
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {}
+
+        std::cout << "Macro-step simulator tests passed!\n";
+    }
+
+    static void test_batch_runner()
+    {
+        std::cout << "Testing batch runner...\n";
+
+        //            BB
+        std::vector<std::string> texts = AllStandardMachines(1, 2);
+        assert(texts.size() == 64);
+        texts.push_back("1RB1LB_1LA1RZ");
+        texts.push_back("1RB1RZ_1LB0RC_1LC1LA");
+        texts.push_back("1RB1LB_1LA0LC_1RZ1LD_1RD0RA");
+        std::vector<TuringMachine<char>> machines;
+        for (const std::string& text : texts)
+        {
+            machines.push_back(TuringMachine<char>(ParseStandardMachine(text), "A"));
+        }
+
+        const unsigned long long budget = 500;
+        for (int threads = 1; threads <= 4; ++threads)
+        {
+            BatchRunner<char> runner('0', threads);
+            int reports = 0;
+            runner.setProgressCallback([&](const BatchProgress& progress)
+                {
+                    assert(progress.done <= progress.total);
+                    ++reports;
+                }, 0.0);
+            //           
+            for (int repeat = 0; repeat < 2; ++repeat)
+            {
+                runner.run(machines, budget);
+                assert(runner.size() == machines.size());
+                for (size_t i = 0; i < machines.size(); ++i)
+                {
+                    Tape<char> tape('0');
+                    RunResult expected = machines[i].run(tape, budget);
+                    const BatchEntry& entry = runner.result(i);
+                    assert(entry.status == expected.status);
+                    assert(entry.steps == expected.steps);
+                    assert(entry.state == expected.state);
+                    assert(entry.position == tape.position());
+
+                    int size = 0;
+                    const char* cells = runner.tape(i, size);
+                    char* expectedCells = nullptr;
+                    int expectedSize = 0;
+                    tape.getContents(expectedCells, expectedSize);
+                    assert(std::string(cells, size) == std::string(expectedCells, expectedSize));
+                    delete[] expectedCells;
+                }
+            }
+            assert(reports >= 2);
+            assert(runner.lastProgress().done == machines.size());
+            assert(runner.lastProgress().total == machines.size());
+        }
+
+        //      
+        BatchRunner<char> light('0', 2, false);
+        light.run(machines, budget);
+        int size = -1;
+        light.tape(0, size);
+        assert(size == 0);
+        assert(light.result(machines.size() - 1).steps == 107);
+
+        std::cout << "Batch runner tests passed!\n";
+    }
+
+    static void test_all()
+    {
+        std::cout << "=== Running TuringMachine Tests ===\n";
+        test_busy_beavers();
+        test_machine_on_input();
+        test_limits_and_errors();
+        test_macro_machine();
+        test_batch_runner();
+        std::cout << "=== All TuringMachine tests passed! ===\n\n";
+    }
+};
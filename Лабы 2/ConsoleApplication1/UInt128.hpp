@@ -0,0 +1,161 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+
+//  128-       .
+//       ,    
+class UInt128
+{
+public:
+    uint64_t high;
+    uint64_t low;
+
+    UInt128(uint64_t value = 0) : high(0), low(value) {}
+
+    UInt128(uint64_t highPart, uint64_t lowPart) : high(highPart), low(lowPart) {}
+
+    //    64- 
+    static UInt128 multiply(uint64_t a, uint64_t b)
+    {
+        uint64_t a0 = a & 0xFFFFFFFFULL, a1 = a >> 32;
+        uint64_t b0 = b & 0xFFFFFFFFULL, b1 = b >> 32;
+        uint64_t p00 = a0 * b0;
+        uint64_t p01 = a0 * b1;
+        uint64_t p10 = a1 * b0;
+        uint64_t p11 = a1 * b1;
+        uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+        return UInt128(p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32), (middle << 32) | (p00 & 0xFFFFFFFFULL));
+    }
+
+    UInt128 operator+(const UInt128& other) const
+    {
+        uint64_t lowSum = low + other.low;
+        uint64_t carry = lowSum < low ? 1 : 0;
+        uint64_t highSum = high + other.high;
+        if (highSum < high || highSum + carry < highSum)
+        {
+            throw std::overflow_error("UInt128 addition overflow");
+        }
+        return UInt128(highSum + carry, lowSum);
+    }
+
+    UInt128& operator+=(const UInt128& other)
+    {
+        return *this = *this + other;
+    }
+
+    UInt128 operator-(const UInt128& other) const
+    {
+        if (*this < other)
+        {
+            throw std::underflow_error("UInt128 subtraction underflow");
+        }
+        return UInt128(high - other.high - (low < other.low ? 1 : 0), low - other.low);
+    }
+
+    UInt128 operator*(uint64_t factor) const
+    {
+        UInt128 lowPart = multiply(low, factor);
+        UInt128 highPart = multiply(high, factor);
+        if (highPart.high != 0)
+        {
+            throw std::overflow_error("UInt128 multiplication overflow");
+        }
+        return lowPart + UInt128(highPart.low, 0);
+    }
+
+    //       64-  (   32 )
+    UInt128 divide(uint64_t divisor, uint64_t& remainder) const
+    {
+        if (divisor == 0)
+        {
+            throw std::domain_error("Division by zero");
+        }
+        if (high == 0)
+        {
+            remainder = low % divisor;
+            return UInt128(low / divisor);
+        }
+        UInt128 quotient;
+        remainder = 0;
+        for (int bit = 127; bit >= 0; --bit)
+        {
+            bool overflow = (remainder >> 63) != 0;
+            remainder = (remainder << 1) | (bit >= 64 ? (high >> (bit - 64)) & 1 : (low >> bit) & 1);
+            if (overflow || remainder >= divisor)
+            {
+                remainder -= divisor;
+                if (bit >= 64)
+                {
+                    quotient.high |= 1ULL << (bit - 64);
+                }
+                else
+                {
+                    quotient.low |= 1ULL << bit;
+                }
+            }
+        }
+        return quotient;
+    }
+
+    UInt128 operator/(uint64_t divisor) const
+    {
+        uint64_t remainder;
+        return divide(divisor, remainder);
+    }
+
+    bool fitsIn64() const
+    {
+        return high == 0;
+    }
+
+    bool operator==(const UInt128& other) const
+    {
+        return high == other.high && low == other.low;
+    }
+
+    bool operator!=(const UInt128& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const UInt128& other) const
+    {
+        return high < other.high || (high == other.high && low < other.low);
+    }
+
+    bool operator>(const UInt128& other) const
+    {
+        return other < *this;
+    }
+
+    bool operator<=(const UInt128& other) const
+    {
+        return !(other < *this);
+    }
+
+    bool operator>=(const UInt128& other) const
+    {
+        return !(*this < other);
+    }
+
+    std::string toString() const
+    {
+        if (high == 0 && low == 0)
+        {
+            return "0";
+        }
+        std::string digits;
+        UInt128 value = *this;
+        while (value.high != 0 || value.low != 0)
+        {
+            uint64_t remainder;
+            value = value.divide(10, remainder);
+            digits.push_back((char)('0' + remainder));
+        }
+        std::reverse(digits.begin(), digits.end());
+        return digits;
+    }
+};
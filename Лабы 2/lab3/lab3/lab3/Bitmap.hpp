@@ -0,0 +1,86 @@
+// Bitmap.hpp
+//        (    )
+
+#ifndef GRAPH_BITMAP_HPP
+#define GRAPH_BITMAP_HPP
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace GraphAlgorithms
+{
+    class AtomicBitmap
+    {
+    private:
+        size_t bitCount;
+        std::vector<std::atomic<uint64_t>> words;
+
+    public:
+        explicit AtomicBitmap(size_t size = 0) : bitCount(size), words((size + 63) / 64)
+        {
+            clear();
+        }
+
+        size_t size() const
+        {
+            return bitCount;
+        }
+
+        size_t wordCount() const
+        {
+            return words.size();
+        }
+
+        void clear()
+        {
+            for (size_t w = 0; w < words.size(); ++w)
+            {
+                words[w].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        bool test(size_t i) const
+        {
+            return (words[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1;
+        }
+
+        //  ; true,      
+        bool trySet(size_t i)
+        {
+            uint64_t mask = uint64_t(1) << (i & 63);
+            if (words[i >> 6].load(std::memory_order_relaxed) & mask)
+            {
+                return false;
+            }
+            return (words[i >> 6].fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+        }
+
+        //     :        
+        bool trySetExclusive(size_t i)
+        {
+            uint64_t mask = uint64_t(1) << (i & 63);
+            uint64_t word = words[i >> 6].load(std::memory_order_relaxed);
+            if (word & mask)
+            {
+                return false;
+            }
+            words[i >> 6].store(word | mask, std::memory_order_relaxed);
+            return true;
+        }
+
+        uint64_t word(size_t w) const
+        {
+            return words[w].load(std::memory_order_relaxed);
+        }
+
+        //   ;  w    
+        void storeWord(size_t w, uint64_t value)
+        {
+            words[w].store(value, std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif // GRAPH_BITMAP_HPP
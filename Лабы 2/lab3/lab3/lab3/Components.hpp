@@ -0,0 +1,207 @@
+// Components.hpp
+//     :      union-find
+
+#ifndef GRAPH_COMPONENTS_HPP
+#define GRAPH_COMPONENTS_HPP
+
+#include <vector>
+#include <atomic>
+#include <utility>
+#include <algorithm>
+#include "Parallel.hpp"
+
+namespace GraphAlgorithms
+{
+    //      CSR:
+    //   c   vertices[offsets[c] .. offsets[c + 1])
+    struct ComponentGroups
+    {
+        std::vector<int> offsets;
+        std::vector<int> vertices;
+
+        int count() const
+        {
+            return offsets.empty() ? 0 : (int)offsets.size() - 1;
+        }
+
+        int size(int component) const
+        {
+            return offsets[component + 1] - offsets[component];
+        }
+
+        const int* begin(int component) const
+        {
+            return vertices.data() + offsets[component];
+        }
+
+        const int* end(int component) const
+        {
+            return vertices.data() + offsets[component + 1];
+        }
+    };
+
+    //    : label[v]     v.
+    //       
+    struct ComponentLabels
+    {
+        std::vector<int> label;
+        int count;
+
+        ComponentLabels() : count(0)
+        {
+        }
+
+        //     , O(V)
+        ComponentGroups grouped() const
+        {
+            ComponentGroups groups;
+            groups.offsets.assign(count + 1, 0);
+            for (size_t v = 0; v < label.size(); ++v)
+            {
+                groups.offsets[label[v] + 1]++;
+            }
+            for (int c = 0; c < count; ++c)
+            {
+                groups.offsets[c + 1] += groups.offsets[c];
+            }
+
+            std::vector<int> cursor(groups.offsets.begin(), groups.offsets.end() - 1);
+            groups.vertices.resize(label.size());
+            for (size_t v = 0; v < label.size(); ++v)
+            {
+                groups.vertices[cursor[label[v]]++] = (int)v;
+            }
+            return groups;
+        }
+    };
+
+    //    : representative[v]     v,
+    //      ,     
+    inline ComponentLabels labelsFromRepresentatives(const std::vector<int>& representative)
+    {
+        ComponentLabels result;
+        result.label.resize(representative.size());
+        std::vector<int> number(representative.size(), -1);
+        for (size_t v = 0; v < representative.size(); ++v)
+        {
+            int& id = number[representative[v]];
+            if (id == -1)
+            {
+                id = result.count++;
+            }
+            result.label[v] = id;
+        }
+        return result;
+    }
+
+    // Union-find  .      ,
+    //  parent[x] <= x,       
+    class ConcurrentUnionFind
+    {
+    private:
+        std::vector<std::atomic<int>> parent;
+
+    public:
+        explicit ConcurrentUnionFind(int n, int threadCount = 1) : parent(n)
+        {
+            parallelFor(parent.size(), threadCount, 1 << 16, [&](int, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        parent[i].store((int)i, std::memory_order_relaxed);
+                    }
+                });
+        }
+
+        int size() const
+        {
+            return (int)parent.size();
+        }
+
+        //      
+        int find(int x)
+        {
+            while (true)
+            {
+                int p = parent[x].load(std::memory_order_relaxed);
+                if (p == x)
+                {
+                    return x;
+                }
+                int grand = parent[p].load(std::memory_order_relaxed);
+                if (grand != p)
+                {
+                    parent[x].compare_exchange_weak(p, grand, std::memory_order_relaxed);
+                }
+                x = grand;
+            }
+        }
+
+        void unite(int a, int b)
+        {
+            while (true)
+            {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                {
+                    return;
+                }
+                if (a < b)
+                {
+                    std::swap(a, b);
+                }
+                int expected = a;
+                if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                {
+                    return;
+                }
+            }
+        }
+
+        //       unite
+        ComponentLabels labels(int threadCount = 1)
+        {
+            ComponentLabels result;
+            result.label.resize(parent.size());
+
+            parallelFor(parent.size(), threadCount, 1 << 16, [&](int, size_t begin, size_t end)
+                {
+                    for (size_t v = begin; v < end; ++v)
+                    {
+                        result.label[v] = find((int)v);
+                    }
+                });
+
+            //     ,     ,
+            //       
+            for (size_t v = 0; v < result.label.size(); ++v)
+            {
+                int root = result.label[v];
+                result.label[v] = (root == (int)v) ? result.count++ : result.label[root];
+            }
+            return result;
+        }
+    };
+
+    //        
+    inline ComponentLabels connectedComponentsOfEdges(int vertexCount, const std::vector<std::pair<int, int>>& edges, int threadCount = 0)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = defaultThreadCount();
+        }
+
+        ConcurrentUnionFind uf(vertexCount, threadCount);
+        parallelFor(edges.size(), threadCount, 1 << 14, [&](int, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    uf.unite(edges[i].first, edges[i].second);
+                }
+            });
+        return uf.labels(threadCount);
+    }
+}
+
+#endif // GRAPH_COMPONENTS_HPP
@@ -0,0 +1,157 @@
+// DagScheduler.hpp
+//    DAG:  ,      
+
+#ifndef DAG_SCHEDULER_HPP
+#define DAG_SCHEDULER_HPP
+
+#include "GraphAlgorithms.hpp"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+
+namespace GraphAlgorithms
+{
+    //    :    ,    
+    class WorkStealingQueue
+    {
+    private:
+        std::deque<int> tasks;
+        std::mutex mutex;
+
+    public:
+        void push(int task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(task);
+        }
+
+        bool pop(int& task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tasks.empty())
+            {
+                return false;
+            }
+            task = tasks.back();
+            tasks.pop_back();
+            return true;
+        }
+
+        bool steal(int& task)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (tasks.empty())
+            {
+                return false;
+            }
+            task = tasks.front();
+            tasks.pop_front();
+            return true;
+        }
+    };
+
+    //  callback(v)          u -> v.
+    //           ,   .
+    //     ,     ,    runtime_error
+    template<typename Callback>
+    void executeDag(const Graph& graph, Callback callback, int threadCount = 0)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = defaultThreadCount();
+        }
+
+        const int V = graph.getVertexCount();
+        std::vector<std::atomic<int>> remaining(V);
+        for (int u = 0; u < V; ++u)
+        {
+            remaining[u].store(0, std::memory_order_relaxed);
+        }
+        for (int u = 0; u < V; ++u)
+        {
+            const auto& edges = graph.getOutEdges(u);
+            for (size_t i = 0; i < edges.size(); ++i)
+            {
+                remaining[edges[i].first].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<std::unique_ptr<WorkStealingQueue>> queues;
+        for (int w = 0; w < threadCount; ++w)
+        {
+            queues.emplace_back(new WorkStealingQueue());
+        }
+
+        // pending      ;   ,    
+        std::atomic<int> pending(0);
+        std::atomic<int> completed(0);
+        std::atomic<bool> stop(false);
+
+        int initial = 0;
+        for (int u = 0; u < V; ++u)
+        {
+            if (remaining[u].load(std::memory_order_relaxed) == 0)
+            {
+                pending.fetch_add(1, std::memory_order_relaxed);
+                queues[initial++ % threadCount]->push(u);
+            }
+        }
+
+        runWorkers(threadCount, [&](int worker)
+            {
+                int task = 0;
+                while (!stop.load(std::memory_order_acquire))
+                {
+                    bool found = queues[worker]->pop(task);
+                    for (int k = 1; !found && k < threadCount; ++k)
+                    {
+                        found = queues[(worker + k) % threadCount]->steal(task);
+                    }
+
+                    if (!found)
+                    {
+                        if (pending.load(std::memory_order_acquire) == 0)
+                        {
+                            break;
+                        }
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    try
+                    {
+                        callback(task);
+                    }
+                    catch (...)
+                    {
+                        stop.store(true, std::memory_order_release);
+                        throw;
+                    }
+
+                    const auto& edges = graph.getOutEdges(task);
+                    for (size_t i = 0; i < edges.size(); ++i)
+                    {
+                        int v = edges[i].first;
+                        if (remaining[v].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        {
+                            pending.fetch_add(1, std::memory_order_relaxed);
+                            queues[worker]->push(v);
+                        }
+                    }
+                    completed.fetch_add(1, std::memory_order_relaxed);
+                    pending.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            });
+
+        if (completed.load() != V)
+        {
+            throw std::runtime_error("  ,   ");
+        }
+    }
+}
+
+#endif // DAG_SCHEDULER_HPP
@@ -0,0 +1,327 @@
+// DynamicGraph.hpp
+//          
+// (     )
+
+#ifndef DYNAMIC_GRAPH_HPP
+#define DYNAMIC_GRAPH_HPP
+
+#include "GraphAlgorithms.hpp"
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace GraphAlgorithms
+{
+    class DynamicGraph
+    {
+    private:
+        typedef std::pair<int, double> edge;
+        typedef std::pair<double, int> pq_element;
+
+        int V;
+        std::vector<std::vector<edge>> out; //  
+        std::vector<std::vector<edge>> in;  //   (    )
+
+        //     source,   
+        int source;
+        std::vector<double> dist;
+        std::vector<int> parent;
+        std::vector<pq_element> heap;
+        size_t lastRepairSize;
+
+        static int findEdge(const std::vector<edge>& list, int to)
+        {
+            for (size_t i = 0; i < list.size(); ++i)
+            {
+                if (list[i].first == to)
+                {
+                    return (int)i;
+                }
+            }
+            return -1;
+        }
+
+        void checkVertex(int u) const
+        {
+            if (u < 0 || u >= V)
+            {
+                throw std::out_of_range("  ");
+            }
+        }
+
+        static void checkWeight(double weight)
+        {
+            if (weight < 0)
+            {
+                throw std::invalid_argument("     ");
+            }
+        }
+
+        bool tracking() const
+        {
+            return source != -1;
+        }
+
+        void pushHeap(double d, int v)
+        {
+            heap.push_back(std::make_pair(d, v));
+            std::push_heap(heap.begin(), heap.end(), std::greater<pq_element>());
+        }
+
+        //   ,    ;     
+        void propagate()
+        {
+            std::greater<pq_element> cmp;
+            while (!heap.empty())
+            {
+                std::pop_heap(heap.begin(), heap.end(), cmp);
+                double currentDist = heap.back().first;
+                int u = heap.back().second;
+                heap.pop_back();
+
+                if (currentDist > dist[u])
+                {
+                    continue;
+                }
+                lastRepairSize++;
+
+                for (size_t i = 0; i < out[u].size(); ++i)
+                {
+                    int v = out[u][i].first;
+                    double candidate = dist[u] + out[u][i].second;
+                    if (candidate < dist[v])
+                    {
+                        dist[v] = candidate;
+                        parent[v] = u;
+                        pushHeap(candidate, v);
+                    }
+                }
+            }
+        }
+
+        //  from -> to    
+        void repairDecrease(int from, int to, double weight)
+        {
+            if (!tracking() || dist[from] + weight >= dist[to])
+            {
+                return;
+            }
+            dist[to] = dist[from] + weight;
+            parent[to] = from;
+            pushHeap(dist[to], to);
+            propagate();
+        }
+
+        //  from -> to    :     ,
+        //     to
+        void repairIncrease(int from, int to)
+        {
+            if (!tracking() || parent[to] != from)
+            {
+                return;
+            }
+
+            //  to    
+            std::vector<int> affected(1, to);
+            std::vector<bool> inAffected(V, false);
+            inAffected[to] = true;
+            for (size_t k = 0; k < affected.size(); ++k)
+            {
+                int u = affected[k];
+                for (size_t i = 0; i < out[u].size(); ++i)
+                {
+                    int v = out[u][i].first;
+                    if (parent[v] == u && !inAffected[v])
+                    {
+                        inAffected[v] = true;
+                        affected.push_back(v);
+                    }
+                }
+            }
+
+            for (size_t k = 0; k < affected.size(); ++k)
+            {
+                dist[affected[k]] = std::numeric_limits<double>::infinity();
+                parent[affected[k]] = -1;
+            }
+
+            //         
+            for (size_t k = 0; k < affected.size(); ++k)
+            {
+                int v = affected[k];
+                for (size_t i = 0; i < in[v].size(); ++i)
+                {
+                    int u = in[v][i].first;
+                    if (inAffected[u])
+                    {
+                        continue;
+                    }
+                    double candidate = dist[u] + in[v][i].second;
+                    if (candidate < dist[v])
+                    {
+                        dist[v] = candidate;
+                        parent[v] = u;
+                    }
+                }
+                if (dist[v] < std::numeric_limits<double>::infinity())
+                {
+                    pushHeap(dist[v], v);
+                }
+            }
+            propagate();
+        }
+
+    public:
+        explicit DynamicGraph(int vertices)
+            : V(vertices), out(vertices), in(vertices), source(-1), lastRepairSize(0)
+        {
+        }
+
+        //    .   u -> v     
+        // :   Graph    ,    
+        explicit DynamicGraph(const Graph& graph) : DynamicGraph(graph.getVertexCount())
+        {
+            for (int u = 0; u < V; ++u)
+            {
+                const auto& edges = graph.getOutEdges(u);
+                for (size_t i = 0; i < edges.size(); ++i)
+                {
+                    int existing = findEdge(out[u], edges[i].first);
+                    if (existing == -1)
+                    {
+                        insertEdge(u, edges[i].first, edges[i].second);
+                    }
+                    else if (edges[i].second < out[u][existing].second)
+                    {
+                        updateWeight(u, edges[i].first, edges[i].second);
+                    }
+                }
+            }
+        }
+
+        int getVertexCount() const
+        {
+            return V;
+        }
+
+        bool hasEdge(int from, int to) const
+        {
+            checkVertex(from);
+            checkVertex(to);
+            return findEdge(out[from], to) != -1;
+        }
+
+        //  ;    ,   
+        void insertEdge(int from, int to, double weight = 1.0)
+        {
+            checkVertex(from);
+            checkVertex(to);
+            checkWeight(weight);
+
+            if (findEdge(out[from], to) != -1)
+            {
+                updateWeight(from, to, weight);
+                return;
+            }
+            out[from].push_back(std::make_pair(to, weight));
+            in[to].push_back(std::make_pair(from, weight));
+
+            lastRepairSize = 0;
+            repairDecrease(from, to, weight);
+        }
+
+        //  ;  false,    
+        bool removeEdge(int from, int to)
+        {
+            checkVertex(from);
+            checkVertex(to);
+
+            int i = findEdge(out[from], to);
+            if (i == -1)
+            {
+                return false;
+            }
+            out[from].erase(out[from].begin() + i);
+            in[to].erase(in[to].begin() + findEdge(in[to], from));
+
+            lastRepairSize = 0;
+            repairIncrease(from, to);
+            return true;
+        }
+
+        void updateWeight(int from, int to, double weight)
+        {
+            checkVertex(from);
+            checkVertex(to);
+            checkWeight(weight);
+
+            int i = findEdge(out[from], to);
+            if (i == -1)
+            {
+                throw std::invalid_argument("  ");
+            }
+            double old = out[from][i].second;
+            out[from][i].second = weight;
+            in[to][findEdge(in[to], from)].second = weight;
+
+            lastRepairSize = 0;
+            if (weight < old)
+            {
+                repairDecrease(from, to, weight);
+            }
+            else if (weight > old)
+            {
+                repairIncrease(from, to);
+            }
+        }
+
+        //    start.      
+        //          
+        const std::vector<double>& shortestPaths(int start)
+        {
+            checkVertex(start);
+            if (source != start)
+            {
+                source = start;
+                dist.assign(V, std::numeric_limits<double>::infinity());
+                parent.assign(V, -1);
+                dist[start] = 0.0;
+                heap.clear();
+                lastRepairSize = 0;
+                pushHeap(0.0, start);
+                propagate();
+            }
+            return dist;
+        }
+
+        //        (-1    )
+        const std::vector<int>& shortestPathTree() const
+        {
+            return parent;
+        }
+
+        //       
+        size_t getLastRepairSize() const
+        {
+            return lastRepairSize;
+        }
+
+        //   
+        Graph toGraph() const
+        {
+            Graph g(V);
+            for (int u = 0; u < V; ++u)
+            {
+                for (size_t i = 0; i < out[u].size(); ++i)
+                {
+                    g.addDirectedEdge(u, out[u][i].first, out[u][i].second);
+                }
+            }
+            return g;
+        }
+    };
+}
+
+#endif // DYNAMIC_GRAPH_HPP
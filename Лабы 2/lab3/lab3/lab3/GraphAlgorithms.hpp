@@ -1,6 +1,7 @@
 // GraphAlgorithms.hpp
 //   3    
-// :   (),   (DFS),  
+// :   (),   (DFS),  ,
+//   ,   ,  
 
 #ifndef GRAPH_ALGORITHMS_HPP
 #define GRAPH_ALGORITHMS_HPP
@@ -17,6 +18,11 @@
 #include <stdexcept>
 #include <cassert>
 #include <cmath>
+#include <atomic>
+#include "Parallel.hpp"
+#include "Components.hpp"
+#include "Bitmap.hpp"
+#include "Reordering.hpp"
 
 namespace GraphAlgorithms
 {
@@ -29,6 +35,63 @@ namespace GraphAlgorithms
         return std::fabs(a - b) < EPSILON;
     }
 
+    //    K x V:      
+    struct DistanceMatrix
+    {
+        int rows;
+        int cols;
+        std::vector<float> data;
+
+        DistanceMatrix(int sourceCount, int vertexCount)
+            : rows(sourceCount), cols(vertexCount),
+            data((size_t)sourceCount * vertexCount, std::numeric_limits<float>::infinity())
+        {
+        }
+
+        float at(int row, int vertex) const
+        {
+            return data[(size_t)row * cols + vertex];
+        }
+
+        float* row(int r)
+        {
+            return data.data() + (size_t)r * cols;
+        }
+
+        const float* row(int r) const
+        {
+            return data.data() + (size_t)r * cols;
+        }
+    };
+
+    //   DAG  :   l  
+    // order[levelOffsets[l] .. levelOffsets[l + 1])      
+    struct TopologicalLevels
+    {
+        std::vector<int> order;
+        std::vector<int> levelOffsets;
+
+        int levelCount() const
+        {
+            return levelOffsets.empty() ? 0 : (int)levelOffsets.size() - 1;
+        }
+
+        int levelSize(int level) const
+        {
+            return levelOffsets[level + 1] - levelOffsets[level];
+        }
+
+        const int* begin(int level) const
+        {
+            return order.data() + levelOffsets[level];
+        }
+
+        const int* end(int level) const
+        {
+            return order.data() + levelOffsets[level + 1];
+        }
+    };
+
     //    
     class Graph
     {
@@ -51,6 +114,18 @@ namespace GraphAlgorithms
             }
         }
 
+        //  
+        int getVertexCount() const
+        {
+            return V;
+        }
+
+        //     
+        const std::vector<std::pair<int, double>>& getOutEdges(int u) const
+        {
+            return adj[u];
+        }
+
         //      
         void addDirectedEdge(int from, int to, double weight = 1.0)
         {
@@ -64,23 +139,71 @@ namespace GraphAlgorithms
             adjUnweighted[v].push_back(u);
         }
 
-        //         
-        std::vector<double> shortestPaths(int start) const
+    private:
+        typedef std::pair<double, int> pq_element;
+
+        //          (    )
+        size_t unweightedDegree(int u) const
         {
-            assert(start >= 0 && start < V);
+            return adjUnweighted.empty() ? 0 : adjUnweighted[u].size();
+        }
 
-            std::vector<double> dist(V, std::numeric_limits<double>::infinity());
-            dist[start] = 0.0;
+        size_t weightedDegree(int u) const
+        {
+            return adj.empty() ? 0 : adj[u].size();
+        }
 
-            typedef std::pair<double, int> pq_element;
-            std::priority_queue<pq_element, std::vector<pq_element>, std::greater<pq_element>> pq;
-            pq.push(std::make_pair(0.0, start));
+        //      source  ,    removed:
+        //     ,     (inOffsets/inSources).    seen
+        void markReachable(int source, bool forward, const std::vector<size_t>& inOffsets, const std::vector<int>& inSources,
+            const std::vector<char>& removed, AtomicBitmap& seen, int threadCount) const
+        {
+            std::vector<int> frontier(1, source);
+            seen.trySet(source);
+            std::vector<std::vector<int>> nextLocal(threadCount);
+            while (!frontier.empty())
+            {
+                parallelFor(frontier.size(), threadCount, 256, [&](int worker, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            int u = frontier[i];
+                            size_t first = forward ? 0 : inOffsets[u];
+                            size_t last = forward ? weightedDegree(u) : inOffsets[u + 1];
+                            for (size_t k = first; k < last; ++k)
+                            {
+                                int v = forward ? adj[u][k].first : inSources[k];
+                                if (!removed[v] && seen.trySet(v))
+                                {
+                                    nextLocal[worker].push_back(v);
+                                }
+                            }
+                        }
+                    });
+                frontier.clear();
+                for (int w = 0; w < threadCount; ++w)
+                {
+                    frontier.insert(frontier.end(), nextLocal[w].begin(), nextLocal[w].end());
+                    nextLocal[w].clear();
+                }
+            }
+        }
 
-            while (!pq.empty())
+        //     : dist  V  ,
+        // heap   ,       
+        void dijkstraInto(int start, std::vector<double>& dist, std::vector<pq_element>& heap) const
+        {
+            std::greater<pq_element> cmp;
+            heap.clear();
+            dist[start] = 0.0;
+            heap.push_back(std::make_pair(0.0, start));
+
+            while (!heap.empty())
             {
-                double currentDist = pq.top().first;
-                int u = pq.top().second;
-                pq.pop();
+                std::pop_heap(heap.begin(), heap.end(), cmp);
+                double currentDist = heap.back().first;
+                int u = heap.back().second;
+                heap.pop_back();
 
                 if (currentDist > dist[u])
                 {
@@ -95,44 +218,404 @@ namespace GraphAlgorithms
                     if (dist[u] + weight < dist[v])
                     {
                         dist[v] = dist[u] + weight;
-                        pq.push(std::make_pair(dist[v], v));
+                        heap.push_back(std::make_pair(dist[v], v));
+                        std::push_heap(heap.begin(), heap.end(), cmp);
                     }
                 }
             }
+        }
+
+    public:
+        //         
+        std::vector<double> shortestPaths(int start) const
+        {
+            std::vector<double> dist(V, std::numeric_limits<double>::infinity());
+            if (V == 0)
+            {
+                return dist;
+            }
+            assert(start >= 0 && start < V);
+
+            std::vector<pq_element> heap;
+            dijkstraInto(start, dist, heap);
             return dist;
         }
 
-        //         DFS
+        //        .
+        //   ,      dist/heap    .
+        //    sources.size() x V,  k  sources[k]
+        DistanceMatrix shortestPathsBatch(const std::vector<int>& sources, int threadCount = 0) const
+        {
+            for (size_t k = 0; k < sources.size(); ++k)
+            {
+                if (sources[k] < 0 || sources[k] >= V)
+                {
+                    throw std::out_of_range("-  ");
+                }
+            }
+
+            DistanceMatrix result((int)sources.size(), V);
+            if (sources.empty())
+            {
+                return result;
+            }
+
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+            threadCount = std::min(threadCount, (int)sources.size());
+
+            std::vector<std::vector<double>> dist(threadCount, std::vector<double>(V));
+            std::vector<std::vector<pq_element>> heaps(threadCount);
+
+            parallelFor(sources.size(), threadCount, 1, [&](int worker, size_t begin, size_t end)
+                {
+                    std::vector<double>& d = dist[worker];
+                    for (size_t k = begin; k < end; ++k)
+                    {
+                        std::fill(d.begin(), d.end(), std::numeric_limits<double>::infinity());
+                        dijkstraInto(sources[k], d, heaps[worker]);
+
+                        float* out = result.row((int)k);
+                        for (int v = 0; v < V; ++v)
+                        {
+                            out[v] = (float)d[v];
+                        }
+                    }
+                });
+            return result;
+        }
+
+        //         DFS.
+        //  :   (,   )  ,
+        //      ,    DFS
         std::vector<std::vector<int>> connectedComponents() const
         {
             std::vector<bool> visited(V, false);
             std::vector<std::vector<int>> components;
+            std::vector<std::pair<int, size_t>> stack;
+
+            for (int i = 0; i < V; ++i)
+            {
+                if (visited[i])
+                {
+                    continue;
+                }
+
+                std::vector<int> comp;
+                visited[i] = true;
+                comp.push_back(i);
+                stack.push_back(std::make_pair(i, (size_t)0));
 
-            std::function<void(int, std::vector<int>&)> dfs = [&](int node, std::vector<int>& comp)
+                while (!stack.empty())
                 {
-                    visited[node] = true;
-                    comp.push_back(node);
+                    int node = stack.back().first;
+                    size_t next = stack.back().second;
 
-                    for (size_t i = 0; i < adjUnweighted[node].size(); ++i)
+                    if (next < unweightedDegree(node))
                     {
-                        int neighbor = adjUnweighted[node][i];
+                        stack.back().second++;
+                        int neighbor = adjUnweighted[node][next];
                         if (!visited[neighbor])
                         {
-                            dfs(neighbor, comp);
+                            visited[neighbor] = true;
+                            comp.push_back(neighbor);
+                            stack.push_back(std::make_pair(neighbor, (size_t)0));
                         }
                     }
-                };
+                    else
+                    {
+                        stack.pop_back();
+                    }
+                }
+                components.push_back(comp);
+            }
+            return components;
+        }
+
+        //        (   )
+        ComponentLabels componentLabels() const
+        {
+            ComponentLabels result;
+            result.label.assign(V, -1);
+            std::vector<int> queue(V);
 
             for (int i = 0; i < V; ++i)
             {
-                if (!visited[i])
+                if (result.label[i] != -1)
+                {
+                    continue;
+                }
+
+                int c = result.count++;
+                int head = 0;
+                int tail = 0;
+                result.label[i] = c;
+                queue[tail++] = i;
+
+                while (head < tail)
                 {
-                    std::vector<int> comp;
-                    dfs(i, comp);
-                    components.push_back(comp);
+                    int u = queue[head++];
+                    for (size_t k = 0; k < unweightedDegree(u); ++k)
+                    {
+                        int v = adjUnweighted[u][k];
+                        if (result.label[v] == -1)
+                        {
+                            result.label[v] = c;
+                            queue[tail++] = v;
+                        }
+                    }
                 }
             }
-            return components;
+            return result;
+        }
+
+        //       Afforest:
+        //       ,   
+        //    ,        
+        ComponentLabels connectedComponentsParallel(int threadCount = 0) const
+        {
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+
+            const size_t neighborRounds = 2;
+            const size_t grain = 1 << 12;
+            ConcurrentUnionFind uf(V, threadCount);
+
+            for (size_t r = 0; r < neighborRounds; ++r)
+            {
+                parallelFor(V, threadCount, grain, [&](int, size_t begin, size_t end)
+                    {
+                        for (size_t u = begin; u < end; ++u)
+                        {
+                            if (r < unweightedDegree((int)u))
+                            {
+                                uf.unite((int)u, adjUnweighted[u][r]);
+                            }
+                        }
+                    });
+            }
+
+            int largest = -1;
+            if (V > 0)
+            {
+                const int samples = 1024;
+                std::unordered_map<int, int> frequency;
+                unsigned int seed = 12345;
+                for (int i = 0; i < samples; ++i)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    int root = uf.find((int)((seed >> 8) % (unsigned int)V));
+                    int seen = ++frequency[root];
+                    if (largest == -1 || seen > frequency[largest])
+                    {
+                        largest = root;
+                    }
+                }
+            }
+
+            // и    ,     
+            //         
+            parallelFor(V, threadCount, grain, [&](int, size_t begin, size_t end)
+                {
+                    for (size_t u = begin; u < end; ++u)
+                    {
+                        if (uf.find((int)u) == largest)
+                        {
+                            continue;
+                        }
+                        for (size_t k = neighborRounds; k < unweightedDegree((int)u); ++k)
+                        {
+                            uf.unite((int)u, adjUnweighted[u][k]);
+                        }
+                    }
+                });
+
+            return uf.labels(threadCount);
+        }
+
+        //     source    ( BFS  ), -1  
+        std::vector<int> hopDistances(int source) const
+        {
+            if (source < 0 || source >= V)
+            {
+                throw std::out_of_range("-  ");
+            }
+
+            std::vector<int> dist(V, -1);
+            std::vector<int> queue(V);
+            int head = 0;
+            int tail = 0;
+            dist[source] = 0;
+            queue[tail++] = source;
+            while (head < tail)
+            {
+                int u = queue[head++];
+                for (size_t k = 0; k < unweightedDegree(u); ++k)
+                {
+                    int v = adjUnweighted[u][k];
+                    if (dist[v] == -1)
+                    {
+                        dist[v] = dist[u] + 1;
+                        queue[tail++] = v;
+                    }
+                }
+            }
+            return dist;
+        }
+
+        //  BFS    (Beamer):   ,  
+        //   ;      ,  
+        //   / alpha,        
+        //      .      
+        //      V / beta
+        std::vector<int> hopDistancesParallel(int source, int threadCount = 0) const
+        {
+            if (source < 0 || source >= V)
+            {
+                throw std::out_of_range("-  ");
+            }
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+
+            const long long alpha = 15;
+            const long long beta = 18;
+            const size_t grain = 1 << 8;
+            const bool serial = threadCount == 1;
+
+            std::vector<int> dist(V, -1);
+            AtomicBitmap visited(V);
+            AtomicBitmap front(V);
+            AtomicBitmap next(V);
+            std::vector<std::vector<int>> nextLocal(threadCount);
+            std::vector<long long> counters(threadCount);
+
+            long long edgesToCheck = 0;
+            for (int u = 0; u < V; ++u)
+            {
+                edgesToCheck += (long long)unweightedDegree(u);
+            }
+
+            std::vector<int> frontier(1, source);
+            dist[source] = 0;
+            visited.trySetExclusive(source);
+            long long scout = (long long)unweightedDegree(source);
+            int level = 0;
+
+            //       ;   counters
+            auto gather = [&]()
+                {
+                    frontier.clear();
+                    long long total = 0;
+                    for (int w = 0; w < threadCount; ++w)
+                    {
+                        frontier.insert(frontier.end(), nextLocal[w].begin(), nextLocal[w].end());
+                        nextLocal[w].clear();
+                        total += counters[w];
+                        counters[w] = 0;
+                    }
+                    return total;
+                };
+
+            while (!frontier.empty())
+            {
+                if (scout > edgesToCheck / alpha)
+                {
+                    front.clear();
+                    for (size_t k = 0; k < frontier.size(); ++k)
+                    {
+                        front.trySetExclusive(frontier[k]);
+                    }
+
+                    long long awake = (long long)frontier.size();
+                    long long previous;
+                    do
+                    {
+                        previous = awake;
+                        //      ,       
+                        parallelFor(front.wordCount(), threadCount, grain, [&](int worker, size_t begin, size_t end)
+                            {
+                                long long found = 0;
+                                for (size_t w = begin; w < end; ++w)
+                                {
+                                    uint64_t bits = 0;
+                                    int last = (int)std::min<size_t>(V, (w + 1) * 64);
+                                    for (int u = (int)(w * 64); u < last; ++u)
+                                    {
+                                        if (dist[u] != -1)
+                                        {
+                                            continue;
+                                        }
+                                        for (size_t k = 0; k < unweightedDegree(u); ++k)
+                                        {
+                                            if (front.test(adjUnweighted[u][k]))
+                                            {
+                                                dist[u] = level + 1;
+                                                bits |= uint64_t(1) << (u & 63);
+                                                ++found;
+                                                break;
+                                            }
+                                        }
+                                    }
+                                    next.storeWord(w, bits);
+                                    visited.storeWord(w, visited.word(w) | bits);
+                                }
+                                counters[worker] += found;
+                            });
+                        awake = gather();
+                        std::swap(front, next);
+                        ++level;
+                    } while (awake >= previous || awake > V / beta);
+
+                    parallelFor(front.wordCount(), threadCount, grain, [&](int worker, size_t begin, size_t end)
+                        {
+                            for (size_t w = begin; w < end; ++w)
+                            {
+                                uint64_t bits = front.word(w);
+                                for (int bit = 0; bits != 0; ++bit, bits >>= 1)
+                                {
+                                    if (bits & 1)
+                                    {
+                                        nextLocal[worker].push_back((int)(w * 64) + bit);
+                                    }
+                                }
+                            }
+                        });
+                    gather();
+                    scout = 1;
+                }
+                else
+                {
+                    edgesToCheck -= scout;
+                    parallelFor(frontier.size(), threadCount, grain, [&](int worker, size_t begin, size_t end)
+                        {
+                            long long degrees = 0;
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                int u = frontier[i];
+                                for (size_t k = 0; k < unweightedDegree(u); ++k)
+                                {
+                                    int v = adjUnweighted[u][k];
+                                    if (serial ? visited.trySetExclusive(v) : visited.trySet(v))
+                                    {
+                                        dist[v] = level + 1;
+                                        nextLocal[worker].push_back(v);
+                                        degrees += (long long)unweightedDegree(v);
+                                    }
+                                }
+                            }
+                            counters[worker] += degrees;
+                        });
+                    scout = gather();
+                    ++level;
+                }
+            }
+            return dist;
         }
 
         //       (DAG)
@@ -182,6 +665,498 @@ namespace GraphAlgorithms
             }
             return order;
         }
+
+        //     :     ,
+        //      ,  ,
+        //     ,      
+        TopologicalLevels topologicalLevels(int threadCount = 0) const
+        {
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+
+            const size_t grain = 1 << 10;
+            std::vector<std::atomic<int>> inDegree(V);
+            for (int u = 0; u < V; ++u)
+            {
+                inDegree[u].store(0, std::memory_order_relaxed);
+            }
+            parallelFor(V, threadCount, grain, [&](int, size_t begin, size_t end)
+                {
+                    for (size_t u = begin; u < end; ++u)
+                    {
+                        for (size_t i = 0; i < adj[u].size(); ++i)
+                        {
+                            inDegree[adj[u][i].first].fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+
+            TopologicalLevels result;
+            result.order.reserve(V);
+            result.levelOffsets.push_back(0);
+            for (int u = 0; u < V; ++u)
+            {
+                if (inDegree[u].load(std::memory_order_relaxed) == 0)
+                {
+                    result.order.push_back(u);
+                }
+            }
+
+            std::vector<std::vector<int>> nextLocal(threadCount);
+            size_t levelBegin = 0;
+            while (levelBegin < result.order.size())
+            {
+                size_t levelEnd = result.order.size();
+                result.levelOffsets.push_back((int)levelEnd);
+
+                const int* frontier = result.order.data() + levelBegin;
+                parallelFor(levelEnd - levelBegin, threadCount, grain, [&](int worker, size_t begin, size_t end)
+                    {
+                        for (size_t k = begin; k < end; ++k)
+                        {
+                            int u = frontier[k];
+                            for (size_t i = 0; i < adj[u].size(); ++i)
+                            {
+                                int v = adj[u][i].first;
+                                if (inDegree[v].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                {
+                                    nextLocal[worker].push_back(v);
+                                }
+                            }
+                        }
+                    });
+
+                for (int w = 0; w < threadCount; ++w)
+                {
+                    result.order.insert(result.order.end(), nextLocal[w].begin(), nextLocal[w].end());
+                    nextLocal[w].clear();
+                }
+                levelBegin = levelEnd;
+            }
+
+            if (result.order.size() != (size_t)V)
+            {
+                throw std::runtime_error("  ,   ");
+            }
+            return result;
+        }
+
+        //     :   .
+        //      (,   )
+        ComponentLabels stronglyConnectedComponents() const
+        {
+            std::vector<int> index(V, -1);
+            std::vector<int> lowlink(V, 0);
+            std::vector<bool> onStack(V, false);
+            std::vector<int> sccStack;
+            std::vector<std::pair<int, size_t>> callStack;
+            std::vector<int> representative(V, -1);
+            int counter = 0;
+
+            for (int root = 0; root < V; ++root)
+            {
+                if (index[root] != -1)
+                {
+                    continue;
+                }
+                callStack.push_back(std::make_pair(root, (size_t)0));
+                index[root] = lowlink[root] = counter++;
+                sccStack.push_back(root);
+                onStack[root] = true;
+
+                while (!callStack.empty())
+                {
+                    int u = callStack.back().first;
+                    size_t& next = callStack.back().second;
+                    if (next < weightedDegree(u))
+                    {
+                        int v = adj[u][next++].first;
+                        if (index[v] == -1)
+                        {
+                            index[v] = lowlink[v] = counter++;
+                            sccStack.push_back(v);
+                            onStack[v] = true;
+                            callStack.push_back(std::make_pair(v, (size_t)0));
+                        }
+                        else if (onStack[v])
+                        {
+                            lowlink[u] = std::min(lowlink[u], index[v]);
+                        }
+                        continue;
+                    }
+
+                    callStack.pop_back();
+                    if (!callStack.empty())
+                    {
+                        int parent = callStack.back().first;
+                        lowlink[parent] = std::min(lowlink[parent], lowlink[u]);
+                    }
+                    if (lowlink[u] == index[u])
+                    {
+                        int w;
+                        do
+                        {
+                            w = sccStack.back();
+                            sccStack.pop_back();
+                            onStack[w] = false;
+                            representative[w] = u;
+                        } while (w != u);
+                    }
+                }
+            }
+            return labelsFromRepresentatives(representative);
+        }
+
+        //        :
+        // 1)             ;
+        // 2) forward-backward      : 
+        //         ,   ;
+        // 3)  :     ,   
+        //    ,   ,          .
+        //     3 ,    
+        ComponentLabels stronglyConnectedComponentsParallel(int threadCount = 0) const
+        {
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+            const size_t grain = 1 << 10;
+
+            //     CSR
+            std::vector<size_t> inOffsets(V + 1, 0);
+            for (int u = 0; u < V; ++u)
+            {
+                for (size_t i = 0; i < weightedDegree(u); ++i)
+                {
+                    inOffsets[adj[u][i].first + 1]++;
+                }
+            }
+            for (int v = 0; v < V; ++v)
+            {
+                inOffsets[v + 1] += inOffsets[v];
+            }
+            std::vector<int> inSources(inOffsets[V]);
+            {
+                std::vector<size_t> cursor(inOffsets.begin(), inOffsets.end() - 1);
+                for (int u = 0; u < V; ++u)
+                {
+                    for (size_t i = 0; i < weightedDegree(u); ++i)
+                    {
+                        inSources[cursor[adj[u][i].first]++] = u;
+                    }
+                }
+            }
+
+            std::vector<int> representative(V, -1);
+            std::vector<char> removed(V, 0);
+            std::vector<int> active(V);
+            for (int v = 0; v < V; ++v)
+            {
+                active[v] = v;
+            }
+            //   active ,  
+            auto compact = [&]()
+                {
+                    size_t kept = 0;
+                    for (size_t i = 0; i < active.size(); ++i)
+                    {
+                        int v = active[i];
+                        if (representative[v] == -1)
+                        {
+                            active[kept++] = v;
+                        }
+                        else
+                        {
+                            removed[v] = 1;
+                        }
+                    }
+                    active.resize(kept);
+                };
+
+            // 1. :  ,    
+            const int trimRounds = 3;
+            for (int round = 0; round < trimRounds && !active.empty(); ++round)
+            {
+                size_t before = active.size();
+                parallelFor(active.size(), threadCount, grain, [&](int, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            int v = active[i];
+                            bool hasOut = false;
+                            for (size_t k = 0; k < weightedDegree(v) && !hasOut; ++k)
+                            {
+                                int w = adj[v][k].first;
+                                hasOut = w != v && !removed[w];
+                            }
+                            bool hasIn = false;
+                            for (size_t k = inOffsets[v]; k < inOffsets[v + 1] && !hasIn; ++k)
+                            {
+                                int w = inSources[k];
+                                hasIn = w != v && !removed[w];
+                            }
+                            if (!hasOut || !hasIn)
+                            {
+                                representative[v] = v;
+                            }
+                        }
+                    });
+                compact();
+                if (active.size() == before)
+                {
+                    break;
+                }
+            }
+
+            // 2. Forward-backward    
+            if (!active.empty())
+            {
+                int pivot = active[0];
+                long long best = -1;
+                for (size_t i = 0; i < active.size(); ++i)
+                {
+                    int v = active[i];
+                    long long product = (long long)weightedDegree(v) * (long long)(inOffsets[v + 1] - inOffsets[v]);
+                    if (product > best)
+                    {
+                        best = product;
+                        pivot = v;
+                    }
+                }
+
+                AtomicBitmap forward(V);
+                AtomicBitmap backward(V);
+                markReachable(pivot, true, inOffsets, inSources, removed, forward, threadCount);
+                markReachable(pivot, false, inOffsets, inSources, removed, backward, threadCount);
+                parallelFor(active.size(), threadCount, grain, [&](int, size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            int v = active[i];
+                            if (forward.test(v) && backward.test(v))
+                            {
+                                representative[v] = pivot;
+                            }
+                        }
+                    });
+                compact();
+            }
+
+            // 3.  
+            std::vector<std::atomic<int>> color(V);
+            while (!active.empty())
+            {
+                for (size_t i = 0; i < active.size(); ++i)
+                {
+                    color[active[i]].store(active[i], std::memory_order_relaxed);
+                }
+
+                //       ,    
+                bool changed = true;
+                while (changed)
+                {
+                    std::atomic<bool> anyChange(false);
+                    parallelFor(active.size(), threadCount, grain, [&](int, size_t begin, size_t end)
+                        {
+                            bool local = false;
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                int u = active[i];
+                                int c = color[u].load(std::memory_order_relaxed);
+                                for (size_t k = 0; k < weightedDegree(u); ++k)
+                                {
+                                    int v = adj[u][k].first;
+                                    if (removed[v])
+                                    {
+                                        continue;
+                                    }
+                                    int current = color[v].load(std::memory_order_relaxed);
+                                    while (current < c && !color[v].compare_exchange_weak(current, c, std::memory_order_relaxed))
+                                    {
+                                    }
+                                    local |= current < c;
+                                }
+                            }
+                            if (local)
+                            {
+                                anyChange.store(true, std::memory_order_relaxed);
+                            }
+                        });
+                    changed = anyChange.load();
+                }
+
+                // ,   ,  ;   r,    r,
+                //   r.    ,     
+                std::vector<int> roots;
+                for (size_t i = 0; i < active.size(); ++i)
+                {
+                    if (color[active[i]].load(std::memory_order_relaxed) == active[i])
+                    {
+                        roots.push_back(active[i]);
+                    }
+                }
+                std::vector<std::vector<int>> queues(threadCount);
+                parallelFor(roots.size(), threadCount, 16, [&](int worker, size_t begin, size_t end)
+                    {
+                        std::vector<int>& queue = queues[worker];
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            int root = roots[i];
+                            queue.clear();
+                            queue.push_back(root);
+                            representative[root] = root;
+                            for (size_t head = 0; head < queue.size(); ++head)
+                            {
+                                int v = queue[head];
+                                for (size_t k = inOffsets[v]; k < inOffsets[v + 1]; ++k)
+                                {
+                                    int w = inSources[k];
+                                    if (!removed[w] && color[w].load(std::memory_order_relaxed) == root && representative[w] == -1)
+                                    {
+                                        representative[w] = root;
+                                        queue.push_back(w);
+                                    }
+                                }
+                            }
+                        }
+                    });
+                compact();
+            }
+
+            return labelsFromRepresentatives(representative);
+        }
+
+        //  :      ,   
+        //        .   DAG,    
+        // topologicalSort  topologicalLevels     
+        Graph condensation(const ComponentLabels& components) const
+        {
+            if ((int)components.label.size() != V)
+            {
+                throw std::invalid_argument("    ");
+            }
+
+            std::vector<std::vector<std::pair<int, double>>> arcs(components.count);
+            for (int u = 0; u < V; ++u)
+            {
+                int cu = components.label[u];
+                for (size_t i = 0; i < weightedDegree(u); ++i)
+                {
+                    int cv = components.label[adj[u][i].first];
+                    if (cu != cv)
+                    {
+                        arcs[cu].push_back(std::make_pair(cv, adj[u][i].second));
+                    }
+                }
+            }
+
+            Graph dag(components.count);
+            for (int c = 0; c < components.count; ++c)
+            {
+                std::sort(arcs[c].begin(), arcs[c].end());
+                for (size_t i = 0; i < arcs[c].size(); ++i)
+                {
+                    if (i == 0 || arcs[c][i].first != arcs[c][i - 1].first)
+                    {
+                        dag.addDirectedEdge(c, arcs[c][i].first, arcs[c][i].second);
+                    }
+                }
+            }
+            return dag;
+        }
+
+        //       .
+        //        ;
+        // window    Gorder (    )
+        VertexPermutation vertexOrdering(VertexOrder method, int window = 5) const
+        {
+            std::vector<std::vector<int>> neighbors(V);
+            size_t arcs = 0;
+            for (int u = 0; u < V; ++u)
+            {
+                for (size_t k = 0; k < unweightedDegree(u); ++k)
+                {
+                    neighbors[u].push_back(adjUnweighted[u][k]);
+                }
+                for (size_t i = 0; i < weightedDegree(u); ++i)
+                {
+                    neighbors[u].push_back(adj[u][i].first);
+                    neighbors[adj[u][i].first].push_back(u);
+                }
+            }
+            for (int u = 0; u < V; ++u)
+            {
+                arcs += neighbors[u].size();
+            }
+
+            std::vector<int> order;
+            if (method == VertexOrder::REVERSE_CUTHILL_MCKEE)
+            {
+                order = detail::reverseCuthillMcKee(neighbors);
+            }
+            else if (method == VertexOrder::DEGREE_DESCENDING)
+            {
+                order = detail::byDegreeDescending(neighbors);
+            }
+            else
+            {
+                size_t averageDegree = V == 0 ? 0 : arcs / V;
+                order = detail::gorder(neighbors, std::max(1, window), std::max<size_t>(16, 2 * averageDegree));
+            }
+
+            std::vector<int> newId(V);
+            for (int i = 0; i < V; ++i)
+            {
+                newId[order[i]] = i;
+            }
+            return VertexPermutation(newId);
+        }
+
+        //    ,   permutation.newId;   
+        //    ,       
+        Graph relabeled(const VertexPermutation& permutation) const
+        {
+            if (permutation.size() != V)
+            {
+                throw std::invalid_argument("      ");
+            }
+
+            Graph result(V, !adj.empty());
+            for (int u = 0; u < V; ++u)
+            {
+                int nu = permutation.newId[u];
+                for (size_t i = 0; i < weightedDegree(u); ++i)
+                {
+                    result.adj[nu].push_back(std::make_pair(permutation.newId[adj[u][i].first], adj[u][i].second));
+                }
+                for (size_t k = 0; k < unweightedDegree(u); ++k)
+                {
+                    result.adjUnweighted[nu].push_back(permutation.newId[adjUnweighted[u][k]]);
+                }
+            }
+            for (int u = 0; u < V; ++u)
+            {
+                if (!adj.empty())
+                {
+                    std::sort(result.adj[u].begin(), result.adj[u].end());
+                }
+                else
+                {
+                    std::sort(result.adjUnweighted[u].begin(), result.adjUnweighted[u].end());
+                }
+            }
+            return result;
+        }
+
+        //    ;      
+        VertexPermutation reorder(VertexOrder method, int window = 5)
+        {
+            VertexPermutation permutation = vertexOrdering(method, window);
+            *this = relabeled(permutation);
+            return permutation;
+        }
     };
 }
 
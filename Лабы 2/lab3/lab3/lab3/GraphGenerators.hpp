@@ -0,0 +1,210 @@
+// GraphGenerators.hpp
+//        .
+//   :     seed      
+
+#ifndef GRAPH_GENERATORS_HPP
+#define GRAPH_GENERATORS_HPP
+
+#include <vector>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <limits>
+#include "GraphAlgorithms.hpp"
+#include "Parallel.hpp"
+
+namespace GraphAlgorithms
+{
+    namespace detail
+    {
+        // и  ,     :      .
+        // edge(rng)   
+        template<typename EdgeFunc>
+        std::vector<std::pair<int, int>> generateEdges(long long edgeCount, unsigned long long seed, int threadCount, EdgeFunc edge)
+        {
+            const size_t block = 1 << 16;
+            std::vector<std::pair<int, int>> edges((size_t)std::max(0LL, edgeCount));
+            size_t blocks = (edges.size() + block - 1) / block;
+            parallelFor(blocks, threadCount, 1, [&](int, size_t first, size_t last)
+                {
+                    for (size_t k = first; k < last; ++k)
+                    {
+                        std::mt19937_64 rng(seed ^ (0x9E3779B97F4A7C15ULL * (k + 1)));
+                        size_t end = std::min(edges.size(), (k + 1) * block);
+                        for (size_t i = k * block; i < end; ++i)
+                        {
+                            edges[i] = edge(rng);
+                        }
+                    }
+                });
+            return edges;
+        }
+    }
+
+    // и R-MAT (    Graph500)  2^scale :    scale
+    //            a, b, c, 1-a-b-c.
+    //     ,      
+    inline std::vector<std::pair<int, int>> rmatEdges(int scale, long long edgeCount, unsigned long long seed,
+        double a = 0.57, double b = 0.19, double c = 0.19, int threadCount = 0)
+    {
+        if (scale < 1 || scale > 30)
+        {
+            throw std::invalid_argument(" R-MAT    1  30");
+        }
+        if (a < 0 || b < 0 || c < 0 || a + b + c > 1)
+        {
+            throw std::invalid_argument("  R-MAT");
+        }
+
+        const int vertexCount = 1 << scale;
+        std::vector<int> relabel(vertexCount);
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            relabel[v] = v;
+        }
+        std::mt19937_64 shuffleRng(seed);
+        std::shuffle(relabel.begin(), relabel.end(), shuffleRng);
+
+        //    32- :  64-     
+        const double scaleFactor = 4294967296.0;
+        const uint64_t ta = (uint64_t)(a * scaleFactor);
+        const uint64_t tab = (uint64_t)((a + b) * scaleFactor);
+        const uint64_t tabc = (uint64_t)((a + b + c) * scaleFactor);
+
+        return detail::generateEdges(edgeCount, seed, threadCount, [&](std::mt19937_64& rng)
+            {
+                int u = 0;
+                int v = 0;
+                uint64_t random = 0;
+                for (int bit = scale - 1; bit >= 0; --bit)
+                {
+                    if ((bit & 1) == ((scale - 1) & 1))
+                    {
+                        random = rng();
+                    }
+                    else
+                    {
+                        random >>= 32;
+                    }
+                    uint64_t r = random & 0xFFFFFFFFULL;
+                    if (r >= tabc)
+                    {
+                        u |= 1 << bit;
+                        v |= 1 << bit;
+                    }
+                    else if (r >= tab)
+                    {
+                        u |= 1 << bit;
+                    }
+                    else if (r >= ta)
+                    {
+                        v |= 1 << bit;
+                    }
+                }
+                return std::make_pair(relabel[u], relabel[v]);
+            });
+    }
+
+    //      
+    inline Graph makeUndirectedGraph(int vertexCount, const std::vector<std::pair<int, int>>& edges)
+    {
+        Graph g(vertexCount, false);
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            g.addUndirectedEdge(edges[i].first, edges[i].second);
+        }
+        return g;
+    }
+
+    //   - G(n, m): m    ,  
+    inline std::vector<std::pair<int, int>> erdosRenyiEdges(int vertexCount, long long edgeCount, unsigned long long seed,
+        int threadCount = 0)
+    {
+        if (vertexCount < 2 && edgeCount > 0)
+        {
+            throw std::invalid_argument("        ");
+        }
+        return detail::generateEdges(edgeCount, seed, threadCount, [&](std::mt19937_64& rng)
+            {
+                std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+                int u = vertex(rng);
+                int v = vertex(rng);
+                while (v == u)
+                {
+                    v = vertex(rng);
+                }
+                return std::make_pair(u, v);
+            });
+    }
+
+    //      ,     [1, maxWeight]
+    inline Graph makeDirectedGraph(int vertexCount, const std::vector<std::pair<int, int>>& edges,
+        unsigned long long seed, double maxWeight = 100.0)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> weight(1.0, maxWeight);
+        Graph g(vertexCount);
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            g.addDirectedEdge(edges[i].first, edges[i].second, weight(rng));
+        }
+        return g;
+    }
+
+    //  rows x cols:          ,
+    //        [1, maxWeight]
+    inline Graph gridGraph(int rows, int cols, unsigned long long seed, double maxWeight = 100.0)
+    {
+        if (rows < 1 || cols < 1 || (long long)rows * cols > std::numeric_limits<int>::max())
+        {
+            throw std::invalid_argument("  ");
+        }
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> weight(1.0, maxWeight);
+        Graph g(rows * cols);
+        for (int r = 0; r < rows; ++r)
+        {
+            for (int c = 0; c < cols; ++c)
+            {
+                int v = r * cols + c;
+                if (c + 1 < cols)
+                {
+                    g.addDirectedEdge(v, v + 1, weight(rng));
+                    g.addDirectedEdge(v + 1, v, weight(rng));
+                }
+                if (r + 1 < rows)
+                {
+                    g.addDirectedEdge(v, v + cols, weight(rng));
+                    g.addDirectedEdge(v + cols, v, weight(rng));
+                }
+            }
+        }
+        return g;
+    }
+
+    //   DAG:    ,   edgeCount 
+    //           
+    inline Graph randomDag(int vertexCount, long long edgeCount, unsigned long long seed, double maxWeight = 100.0)
+    {
+        std::vector<std::pair<int, int>> edges = erdosRenyiEdges(vertexCount, edgeCount, seed);
+        std::vector<int> rank(vertexCount);
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            rank[v] = v;
+        }
+        std::mt19937_64 rng(seed + 1);
+        std::shuffle(rank.begin(), rank.end(), rng);
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            if (rank[edges[i].first] > rank[edges[i].second])
+            {
+                std::swap(edges[i].first, edges[i].second);
+            }
+        }
+        return makeDirectedGraph(vertexCount, edges, seed + 2, maxWeight);
+    }
+}
+
+#endif // GRAPH_GENERATORS_HPP
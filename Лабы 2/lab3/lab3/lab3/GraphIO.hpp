@@ -0,0 +1,738 @@
+// GraphIO.hpp
+//    : DIMACS .gr, Matrix Market,      CSR.
+//             
+
+#ifndef GRAPH_IO_HPP
+#define GRAPH_IO_HPP
+
+#include "GraphAlgorithms.hpp"
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GraphAlgorithms
+{
+    //    CSR:   u   targets[offsets[u] .. offsets[u + 1]),
+    //      . weights ,      
+    struct CsrGraph
+    {
+        int vertexCount;
+        std::vector<size_t> offsets;
+        std::vector<int> targets;
+        std::vector<double> weights;
+
+        CsrGraph() : vertexCount(0), offsets(1, 0)
+        {
+        }
+
+        size_t edgeCount() const
+        {
+            return targets.size();
+        }
+
+        bool isWeighted() const
+        {
+            return !weights.empty();
+        }
+
+        size_t degree(int u) const
+        {
+            return offsets[u + 1] - offsets[u];
+        }
+
+        double weight(size_t arc) const
+        {
+            return weights.empty() ? 1.0 : weights[arc];
+        }
+
+        bool hasArc(int u, int v) const
+        {
+            return std::binary_search(targets.begin() + offsets[u], targets.begin() + offsets[u + 1], v);
+        }
+
+        //   Graph    
+        Graph toGraph() const
+        {
+            Graph g(vertexCount);
+            for (int u = 0; u < vertexCount; ++u)
+            {
+                for (size_t i = offsets[u]; i < offsets[u + 1]; ++i)
+                {
+                    g.addDirectedEdge(u, targets[i], weight(i));
+                }
+            }
+            return g;
+        }
+
+        //   Graph:   u -> v  v -> u   
+        Graph toUndirectedGraph() const
+        {
+            Graph g(vertexCount, false);
+            for (int u = 0; u < vertexCount; ++u)
+            {
+                for (size_t i = offsets[u]; i < offsets[u + 1]; ++i)
+                {
+                    int v = targets[i];
+                    if (u <= v || !hasArc(v, u))
+                    {
+                        g.addUndirectedEdge(u, v);
+                    }
+                }
+            }
+            return g;
+        }
+    };
+
+    // ,      
+    class MappedFile
+    {
+    private:
+        const char* data;
+        size_t length;
+#ifdef _WIN32
+        HANDLE file;
+        HANDLE mapping;
+#else
+        int fd;
+#endif
+
+    public:
+        explicit MappedFile(const std::string& path) : data(nullptr), length(0)
+        {
+#ifdef _WIN32
+            mapping = nullptr;
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                throw std::runtime_error("   : " + path);
+            }
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize))
+            {
+                CloseHandle(file);
+                throw std::runtime_error("    : " + path);
+            }
+            length = (size_t)fileSize.QuadPart;
+            if (length > 0)
+            {
+                mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                data = mapping ? (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+                if (!data)
+                {
+                    if (mapping)
+                    {
+                        CloseHandle(mapping);
+                    }
+                    CloseHandle(file);
+                    throw std::runtime_error("     : " + path);
+                }
+            }
+#else
+            fd = open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+            {
+                throw std::runtime_error("   : " + path);
+            }
+            struct stat info;
+            if (fstat(fd, &info) == -1)
+            {
+                close(fd);
+                throw std::runtime_error("    : " + path);
+            }
+            length = (size_t)info.st_size;
+            if (length > 0)
+            {
+                void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED)
+                {
+                    close(fd);
+                    throw std::runtime_error("     : " + path);
+                }
+                madvise(mapped, length, MADV_SEQUENTIAL);
+                data = (const char*)mapped;
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile()
+        {
+#ifdef _WIN32
+            if (data)
+            {
+                UnmapViewOfFile(data);
+            }
+            if (mapping)
+            {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+#else
+            if (data)
+            {
+                munmap((void*)data, length);
+            }
+            close(fd);
+#endif
+        }
+
+        const char* begin() const
+        {
+            return data;
+        }
+
+        size_t size() const
+        {
+            return length;
+        }
+    };
+
+    namespace detail
+    {
+        struct RawEdge
+        {
+            int from;
+            int to;
+            double weight;
+        };
+
+        inline bool isBlank(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        inline const char* skipBlanks(const char* p, const char* end)
+        {
+            while (p < end && isBlank(*p))
+            {
+                ++p;
+            }
+            return p;
+        }
+
+        inline const char* nextLine(const char* p, const char* end)
+        {
+            const char* eol = (const char*)std::memchr(p, '\n', end - p);
+            return eol ? eol + 1 : end;
+        }
+
+        inline bool readInt(const char*& p, const char* end, long long& value)
+        {
+            p = skipBlanks(p, end);
+            std::from_chars_result r = std::from_chars(p, end, value);
+            if (r.ec != std::errc())
+            {
+                return false;
+            }
+            p = r.ptr;
+            return true;
+        }
+
+        inline bool readDouble(const char*& p, const char* end, double& value)
+        {
+            p = skipBlanks(p, end);
+            if (p < end && *p == '+')
+            {
+                ++p;
+            }
+            std::from_chars_result r = std::from_chars(p, end, value);
+            if (r.ec != std::errc())
+            {
+                return false;
+            }
+            p = r.ptr;
+            return true;
+        }
+
+        inline void parseError(const char* message)
+        {
+            throw std::runtime_error(std::string("   : ") + message);
+        }
+
+        //        base. ,    int,  ,
+        //       
+        inline int vertexId(long long id, int base)
+        {
+            if (id > (long long)std::numeric_limits<int>::max() + base || id < (long long)std::numeric_limits<int>::min() + base)
+            {
+                parseError("     int");
+            }
+            return (int)(id - base);
+        }
+
+        //    :  0  INT_MAX
+        inline int checkedVertexCount(long long count)
+        {
+            if (count < 0 || count > std::numeric_limits<int>::max())
+            {
+                parseError("  ");
+            }
+            return (int)count;
+        }
+
+        //    
+        enum class LineFormat
+        {
+            DIMACS,        // a u v w,   1
+            MATRIX_MARKET, // i j [w],   1
+            EDGE_LIST      // u v [w],   0
+        };
+
+        //    .  false     
+        inline bool parseLine(const char* p, const char* end, LineFormat format, RawEdge& edge, bool& hasWeight)
+        {
+            p = skipBlanks(p, end);
+            if (p == end || *p == '\n')
+            {
+                return false;
+            }
+
+            long long from = 0;
+            long long to = 0;
+            int base = 0;
+            switch (format)
+            {
+            case LineFormat::DIMACS:
+                if (*p != 'a')
+                {
+                    return false; //  c    p
+                }
+                ++p;
+                base = 1;
+                break;
+            case LineFormat::MATRIX_MARKET:
+                if (*p == '%')
+                {
+                    return false;
+                }
+                base = 1;
+                break;
+            case LineFormat::EDGE_LIST:
+                if (*p == '#' || *p == '%')
+                {
+                    return false;
+                }
+                break;
+            }
+
+            if (!readInt(p, end, from) || !readInt(p, end, to))
+            {
+                parseError("  ");
+            }
+            edge.from = vertexId(from, base);
+            edge.to = vertexId(to, base);
+            edge.weight = 1.0;
+
+            const char* q = skipBlanks(p, end);
+            hasWeight = q < end && *q != '\n';
+            if (hasWeight && !readDouble(q, end, edge.weight))
+            {
+                parseError("  ");
+            }
+            return true;
+        }
+
+        //    [begin, end)   CSR.
+        // vertexCount < 0      
+        inline CsrGraph parseBody(const char* begin, const char* end, LineFormat format, int vertexCount,
+            bool symmetric, bool forceUnweighted, int threadCount)
+        {
+            if (threadCount <= 0)
+            {
+                threadCount = defaultThreadCount();
+            }
+
+            //    ,      
+            const size_t minChunk = 1 << 20;
+            size_t total = end - begin;
+            int chunks = (int)std::max<size_t>(1, std::min<size_t>(threadCount * 4, total / minChunk + 1));
+            std::vector<const char*> bounds(chunks + 1);
+            bounds[0] = begin;
+            bounds[chunks] = end;
+            for (int c = 1; c < chunks; ++c)
+            {
+                const char* p = begin + total / chunks * c;
+                bounds[c] = std::max(bounds[c - 1], p > begin && p[-1] != '\n' ? nextLine(p, end) : p);
+            }
+
+            std::vector<std::vector<RawEdge>> parsed(chunks);
+            std::vector<int> maxVertex(chunks, -1);
+            std::vector<char> weighted(chunks, 0);
+
+            parallelFor(chunks, threadCount, 1, [&](int, size_t first, size_t last)
+                {
+                    for (size_t c = first; c < last; ++c)
+                    {
+                        std::vector<RawEdge>& edges = parsed[c];
+                        edges.reserve((bounds[c + 1] - bounds[c]) / 12);
+                        for (const char* p = bounds[c]; p < bounds[c + 1]; p = nextLine(p, bounds[c + 1]))
+                        {
+                            RawEdge edge;
+                            bool hasWeight = false;
+                            if (!parseLine(p, bounds[c + 1], format, edge, hasWeight))
+                            {
+                                continue;
+                            }
+                            if (edge.from < 0 || edge.to < 0)
+                            {
+                                parseError("  ");
+                            }
+                            weighted[c] |= (char)hasWeight;
+                            maxVertex[c] = std::max(maxVertex[c], std::max(edge.from, edge.to));
+                            edges.push_back(edge);
+                            if (symmetric && edge.from != edge.to)
+                            {
+                                std::swap(edge.from, edge.to);
+                                edges.push_back(edge);
+                            }
+                        }
+                    }
+                });
+
+            int maxId = *std::max_element(maxVertex.begin(), maxVertex.end());
+            if (vertexCount < 0)
+            {
+                vertexCount = maxId + 1;
+            }
+            else if (maxId >= vertexCount)
+            {
+                parseError("     ");
+            }
+            bool keepWeights = !forceUnweighted && std::find(weighted.begin(), weighted.end(), 1) != weighted.end();
+
+            CsrGraph csr;
+            csr.vertexCount = vertexCount;
+
+            //     .      
+            // :      
+            bool serial = threadCount == 1 || chunks == 1;
+            std::vector<size_t> plainCursor(serial ? vertexCount + 1 : 0, 0);
+            std::vector<std::atomic<size_t>> sharedCursor(serial ? 0 : vertexCount + 1);
+            for (size_t u = 0; u < sharedCursor.size(); ++u)
+            {
+                sharedCursor[u].store(0, std::memory_order_relaxed);
+            }
+            auto claim = [&](int u) -> size_t
+            {
+                return serial ? plainCursor[u]++ : sharedCursor[u].fetch_add(1, std::memory_order_relaxed);
+            };
+            parallelFor(chunks, threadCount, 1, [&](int, size_t first, size_t last)
+                {
+                    for (size_t c = first; c < last; ++c)
+                    {
+                        for (size_t i = 0; i < parsed[c].size(); ++i)
+                        {
+                            claim(parsed[c][i].from);
+                        }
+                    }
+                });
+
+            csr.offsets.assign(vertexCount + 1, 0);
+            for (int u = 0; u < vertexCount; ++u)
+            {
+                if (serial)
+                {
+                    csr.offsets[u + 1] = csr.offsets[u] + plainCursor[u];
+                    plainCursor[u] = csr.offsets[u];
+                }
+                else
+                {
+                    csr.offsets[u + 1] = csr.offsets[u] + sharedCursor[u].load(std::memory_order_relaxed);
+                    sharedCursor[u].store(csr.offsets[u], std::memory_order_relaxed);
+                }
+            }
+
+            size_t edgeTotal = csr.offsets[vertexCount];
+            csr.targets.resize(edgeTotal);
+            if (keepWeights)
+            {
+                csr.weights.resize(edgeTotal);
+            }
+
+            //        :        
+            std::vector<std::pair<int, double>> arcs(keepWeights ? edgeTotal : 0);
+            parallelFor(chunks, threadCount, 1, [&](int, size_t first, size_t last)
+                {
+                    for (size_t c = first; c < last; ++c)
+                    {
+                        for (size_t i = 0; i < parsed[c].size(); ++i)
+                        {
+                            const RawEdge& edge = parsed[c][i];
+                            size_t slot = claim(edge.from);
+                            if (keepWeights)
+                            {
+                                arcs[slot] = std::make_pair(edge.to, edge.weight);
+                            }
+                            else
+                            {
+                                csr.targets[slot] = edge.to;
+                            }
+                        }
+                        std::vector<RawEdge>().swap(parsed[c]);
+                    }
+                });
+
+            //           
+            parallelFor(vertexCount, threadCount, 1 << 12, [&](int, size_t first, size_t last)
+                {
+                    for (size_t u = first; u < last; ++u)
+                    {
+                        size_t b = csr.offsets[u];
+                        size_t e = csr.offsets[u + 1];
+                        if (!keepWeights)
+                        {
+                            std::sort(csr.targets.begin() + b, csr.targets.begin() + e);
+                            continue;
+                        }
+                        std::sort(arcs.begin() + b, arcs.begin() + e);
+                        for (size_t i = b; i < e; ++i)
+                        {
+                            csr.targets[i] = arcs[i].first;
+                            csr.weights[i] = arcs[i].second;
+                        }
+                    }
+                });
+            return csr;
+        }
+    }
+
+    // DIMACS .gr:  "c ..."  , "p sp V E"  , "a u v w"  
+    inline CsrGraph parseDimacs(const char* text, size_t size, int threadCount = 0)
+    {
+        const char* end = text + size;
+        for (const char* p = text; p < end; p = detail::nextLine(p, end))
+        {
+            const char* q = detail::skipBlanks(p, end);
+            if (q < end && *q == 'p')
+            {
+                q = detail::skipBlanks(q + 1, end);
+                while (q < end && !detail::isBlank(*q) && *q != '\n')
+                {
+                    ++q; //  ,  "sp"
+                }
+                long long vertices = 0;
+                long long arcs = 0;
+                if (!detail::readInt(q, end, vertices) || !detail::readInt(q, end, arcs))
+                {
+                    detail::parseError("  p");
+                }
+                return detail::parseBody(detail::nextLine(p, end), end, detail::LineFormat::DIMACS,
+                    detail::checkedVertexCount(vertices), false, false, threadCount);
+            }
+        }
+        detail::parseError("  p");
+        return CsrGraph();
+    }
+
+    // Matrix Market coordinate:  "%%MatrixMarket matrix coordinate <> <>",
+    //  "rows cols nnz",  "i j [value]".  real, integer  pattern ( ),
+    //  general  symmetric   symmetric   ,  .
+    // skew-symmetric  hermitian          
+    inline CsrGraph parseMatrixMarket(const char* text, size_t size, int threadCount = 0)
+    {
+        const char* end = text + size;
+        const char* p = text;
+        std::vector<std::string> fields;
+        for (const char* q = p; q < end && *q != '\n';)
+        {
+            q = detail::skipBlanks(q, end);
+            const char* start = q;
+            while (q < end && !detail::isBlank(*q) && *q != '\n')
+            {
+                ++q;
+            }
+            if (q > start)
+            {
+                std::string token(start, q);
+                std::transform(token.begin(), token.end(), token.begin(), [](char c) { return (char)std::tolower((unsigned char)c); });
+                fields.push_back(token);
+            }
+        }
+        if (fields.size() != 5 || fields[0] != "%%matrixmarket" || fields[1] != "matrix" || fields[2] != "coordinate")
+        {
+            detail::parseError("  %%MatrixMarket matrix coordinate");
+        }
+        if (fields[3] != "real" && fields[3] != "integer" && fields[3] != "pattern")
+        {
+            detail::parseError("  real, integer  pattern");
+        }
+        if (fields[4] != "general" && fields[4] != "symmetric")
+        {
+            detail::parseError("  general  symmetric");
+        }
+        bool symmetric = fields[4] == "symmetric";
+        bool pattern = fields[3] == "pattern";
+
+        for (p = detail::nextLine(p, end); p < end; p = detail::nextLine(p, end))
+        {
+            const char* q = detail::skipBlanks(p, end);
+            if (q == end || *q == '%' || *q == '\n')
+            {
+                continue;
+            }
+            long long rows = 0;
+            long long cols = 0;
+            long long entries = 0;
+            if (!detail::readInt(q, end, rows) || !detail::readInt(q, end, cols) || !detail::readInt(q, end, entries))
+            {
+                detail::parseError("  ");
+            }
+            return detail::parseBody(detail::nextLine(p, end), end, detail::LineFormat::MATRIX_MARKET,
+                detail::checkedVertexCount(std::max(rows, cols)), symmetric, pattern, threadCount);
+        }
+        detail::parseError("  ");
+        return CsrGraph();
+    }
+
+    //  : "u v [w]"    ,   #  %  
+    inline CsrGraph parseEdgeList(const char* text, size_t size, int threadCount = 0)
+    {
+        return detail::parseBody(text, text + size, detail::LineFormat::EDGE_LIST, -1, false, false, threadCount);
+    }
+
+    inline CsrGraph loadDimacs(const std::string& path, int threadCount = 0)
+    {
+        MappedFile file(path);
+        return parseDimacs(file.begin(), file.size(), threadCount);
+    }
+
+    inline CsrGraph loadMatrixMarket(const std::string& path, int threadCount = 0)
+    {
+        MappedFile file(path);
+        return parseMatrixMarket(file.begin(), file.size(), threadCount);
+    }
+
+    inline CsrGraph loadEdgeList(const std::string& path, int threadCount = 0)
+    {
+        MappedFile file(path);
+        return parseEdgeList(file.begin(), file.size(), threadCount);
+    }
+
+    //   CSR:    offsets/targets/weights   (  )
+    namespace detail
+    {
+        const char SNAPSHOT_MAGIC[8] = { 'G', 'R', 'C', 'S', 'R', 'v', '1', '\0' };
+
+        struct SnapshotHeader
+        {
+            char magic[8];
+            std::uint64_t vertexCount;
+            std::uint64_t edgeCount;
+            std::uint64_t weighted;
+        };
+    }
+
+    inline void saveSnapshot(const CsrGraph& graph, const std::string& path)
+    {
+        std::ofstream out(path, std::ios::binary);
+        if (!out)
+        {
+            throw std::runtime_error("   : " + path);
+        }
+
+        detail::SnapshotHeader header;
+        std::memcpy(header.magic, detail::SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.vertexCount = (std::uint64_t)graph.vertexCount;
+        header.edgeCount = graph.edgeCount();
+        header.weighted = graph.isWeighted() ? 1 : 0;
+
+        std::vector<std::uint64_t> offsets(graph.offsets.begin(), graph.offsets.end());
+        out.write((const char*)&header, sizeof(header));
+        out.write((const char*)offsets.data(), offsets.size() * sizeof(std::uint64_t));
+        out.write((const char*)graph.targets.data(), graph.targets.size() * sizeof(int));
+        if (graph.isWeighted())
+        {
+            out.write((const char*)graph.weights.data(), graph.weights.size() * sizeof(double));
+        }
+        if (!out)
+        {
+            throw std::runtime_error("  : " + path);
+        }
+    }
+
+    inline CsrGraph loadSnapshot(const std::string& path)
+    {
+        MappedFile file(path);
+        detail::SnapshotHeader header;
+        if (file.size() < sizeof(header))
+        {
+            throw std::runtime_error("    : " + path);
+        }
+        std::memcpy(&header, file.begin(), sizeof(header));
+        if (std::memcmp(header.magic, detail::SNAPSHOT_MAGIC, sizeof(header.magic)) != 0)
+        {
+            throw std::runtime_error("    : " + path);
+        }
+
+        //    ,      
+        if (header.vertexCount > (std::uint64_t)std::numeric_limits<int>::max() || header.edgeCount > file.size()
+            || header.weighted > 1)
+        {
+            throw std::runtime_error("  : " + path);
+        }
+        size_t vertices = (size_t)header.vertexCount;
+        size_t edges = (size_t)header.edgeCount;
+        size_t expected = sizeof(header) + (vertices + 1) * sizeof(std::uint64_t) + edges * sizeof(int)
+            + (header.weighted ? edges * sizeof(double) : 0);
+        if (file.size() != expected)
+        {
+            throw std::runtime_error("  : " + path);
+        }
+
+        CsrGraph graph;
+        graph.vertexCount = (int)vertices;
+        const char* p = file.begin() + sizeof(header);
+        const std::uint64_t* offsets = (const std::uint64_t*)p;
+        graph.offsets.assign(offsets, offsets + vertices + 1);
+        p += (vertices + 1) * sizeof(std::uint64_t);
+        graph.targets.resize(edges);
+        std::memcpy(graph.targets.data(), p, edges * sizeof(int));
+        p += edges * sizeof(int);
+        if (header.weighted)
+        {
+            graph.weights.resize(edges);
+            std::memcpy(graph.weights.data(), p, edges * sizeof(double));
+        }
+
+        //       :   0  edges  ,
+        //     .  degree, hasArc     
+        bool valid = graph.offsets[0] == 0 && graph.offsets[vertices] == edges;
+        for (size_t u = 0; valid && u < vertices; ++u)
+        {
+            valid = graph.offsets[u] <= graph.offsets[u + 1];
+        }
+        for (size_t i = 0; valid && i < edges; ++i)
+        {
+            valid = graph.targets[i] >= 0 && graph.targets[i] < graph.vertexCount;
+        }
+        if (!valid)
+        {
+            throw std::runtime_error("  : " + path);
+        }
+        return graph;
+    }
+}
+
+#endif // GRAPH_IO_HPP
@@ -0,0 +1,99 @@
+// Parallel.hpp
+//       
+
+#ifndef GRAPH_PARALLEL_HPP
+#define GRAPH_PARALLEL_HPP
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <algorithm>
+
+namespace GraphAlgorithms
+{
+    //     (  )
+    inline int defaultThreadCount()
+    {
+        unsigned int n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : (int)n;
+    }
+
+    //  workerCount ,   body(workerId).
+    //  0    ,     join
+    template<typename Body>
+    void runWorkers(int workerCount, Body body)
+    {
+        if (workerCount <= 0)
+        {
+            workerCount = defaultThreadCount();
+        }
+        if (workerCount == 1)
+        {
+            body(0);
+            return;
+        }
+
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto guarded = [&](int worker)
+            {
+                try
+                {
+                    body(worker);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workerCount - 1);
+        for (int w = 1; w < workerCount; ++w)
+        {
+            threads.emplace_back(guarded, w);
+        }
+        guarded(0);
+        for (size_t i = 0; i < threads.size(); ++i)
+        {
+            threads[i].join();
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    //    [0, count)   grain .
+    // body(workerId, begin, end)    
+    template<typename Body>
+    void parallelFor(size_t count, int workerCount, size_t grain, Body body)
+    {
+        if (grain == 0)
+        {
+            grain = 1;
+        }
+        std::atomic<size_t> next(0);
+        runWorkers(workerCount, [&](int worker)
+            {
+                while (true)
+                {
+                    size_t begin = next.fetch_add(grain);
+                    if (begin >= count)
+                    {
+                        break;
+                    }
+                    body(worker, begin, std::min(count, begin + grain));
+                }
+            });
+    }
+}
+
+#endif // GRAPH_PARALLEL_HPP
@@ -0,0 +1,264 @@
+// Reordering.hpp
+//      :  -,   , Gorder
+
+#ifndef GRAPH_REORDERING_HPP
+#define GRAPH_REORDERING_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace GraphAlgorithms
+{
+    enum class VertexOrder
+    {
+        REVERSE_CUTHILL_MCKEE, //        ,  
+        DEGREE_DESCENDING,     //     
+        GORDER                 //  :      ( Gorder)
+    };
+
+    //  : newId[old]   , oldId[new]  .
+    //         ...ToOriginal
+    struct VertexPermutation
+    {
+        std::vector<int> newId;
+        std::vector<int> oldId;
+
+        VertexPermutation() {}
+
+        explicit VertexPermutation(const std::vector<int>& oldToNew) : newId(oldToNew), oldId(oldToNew.size(), -1)
+        {
+            for (size_t v = 0; v < newId.size(); ++v)
+            {
+                if (newId[v] < 0 || newId[v] >= (int)newId.size() || oldId[newId[v]] != -1)
+                {
+                    throw std::invalid_argument("     ");
+                }
+                oldId[newId[v]] = (int)v;
+            }
+        }
+
+        int size() const
+        {
+            return (int)newId.size();
+        }
+
+        // ,    (, ),    
+        template<typename T>
+        std::vector<T> valuesToOriginal(const std::vector<T>& byNewId) const
+        {
+            std::vector<T> result(byNewId.size());
+            for (size_t v = 0; v < newId.size(); ++v)
+            {
+                result[v] = byNewId[newId[v]];
+            }
+            return result;
+        }
+
+        //     ( , )   
+        std::vector<int> idsToOriginal(const std::vector<int>& ids) const
+        {
+            std::vector<int> result(ids.size());
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                result[i] = oldId[ids[i]];
+            }
+            return result;
+        }
+
+        std::vector<std::vector<int>> groupsToOriginal(const std::vector<std::vector<int>>& groups) const
+        {
+            std::vector<std::vector<int>> result(groups.size());
+            for (size_t g = 0; g < groups.size(); ++g)
+            {
+                result[g] = idsToOriginal(groups[g]);
+            }
+            return result;
+        }
+    };
+
+    namespace detail
+    {
+        // ,     (    )
+        inline std::vector<int> byDegreeDescending(const std::vector<std::vector<int>>& neighbors)
+        {
+            std::vector<int> order(neighbors.size());
+            for (size_t v = 0; v < order.size(); ++v)
+            {
+                order[v] = (int)v;
+            }
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                {
+                    return neighbors[a].size() > neighbors[b].size();
+                });
+            return order;
+        }
+
+        //  -:        
+        // ,     ,   
+        inline std::vector<int> reverseCuthillMcKee(const std::vector<std::vector<int>>& neighbors)
+        {
+            int n = (int)neighbors.size();
+            std::vector<int> starts = byDegreeDescending(neighbors);
+            std::reverse(starts.begin(), starts.end());
+
+            std::vector<int> order;
+            order.reserve(n);
+            std::vector<bool> visited(n, false);
+            std::vector<int> batch;
+            for (int s = 0; s < n; ++s)
+            {
+                if (visited[starts[s]])
+                {
+                    continue;
+                }
+                size_t head = order.size();
+                visited[starts[s]] = true;
+                order.push_back(starts[s]);
+                while (head < order.size())
+                {
+                    int u = order[head++];
+                    batch.clear();
+                    for (size_t k = 0; k < neighbors[u].size(); ++k)
+                    {
+                        int v = neighbors[u][k];
+                        if (!visited[v])
+                        {
+                            visited[v] = true;
+                            batch.push_back(v);
+                        }
+                    }
+                    std::stable_sort(batch.begin(), batch.end(), [&](int a, int b)
+                        {
+                            return neighbors[a].size() < neighbors[b].size();
+                        });
+                    order.insert(order.end(), batch.begin(), batch.end());
+                }
+            }
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+        //  Gorder:         
+        //  window        .   
+        //          ,    
+        //          O(1)  .
+        //       hubDegree  :  
+        //      ,      
+        inline std::vector<int> gorder(const std::vector<std::vector<int>>& neighbors, int window, size_t hubDegree)
+        {
+            int n = (int)neighbors.size();
+            std::vector<int> order;
+            order.reserve(n);
+            std::vector<int> score(n, 0);
+            std::vector<bool> placed(n, false);
+            std::vector<int> prev(n, -1);
+            std::vector<int> next(n, -1);
+            std::vector<int> bucket(1, -1);
+            int top = 0;
+
+            auto unlink = [&](int v)
+                {
+                    if (prev[v] != -1)
+                    {
+                        next[prev[v]] = next[v];
+                    }
+                    else
+                    {
+                        bucket[score[v]] = next[v];
+                    }
+                    if (next[v] != -1)
+                    {
+                        prev[next[v]] = prev[v];
+                    }
+                };
+            auto link = [&](int v)
+                {
+                    if (score[v] >= (int)bucket.size())
+                    {
+                        bucket.resize(score[v] + 1, -1);
+                    }
+                    prev[v] = -1;
+                    next[v] = bucket[score[v]];
+                    if (next[v] != -1)
+                    {
+                        prev[next[v]] = v;
+                    }
+                    bucket[score[v]] = v;
+                    top = std::max(top, score[v]);
+                };
+            auto change = [&](int v, int delta)
+                {
+                    if (placed[v])
+                    {
+                        return;
+                    }
+                    if (score[v] > 0)
+                    {
+                        unlink(v);
+                    }
+                    score[v] += delta;
+                    if (score[v] > 0)
+                    {
+                        link(v);
+                    }
+                };
+            auto adjust = [&](int v, int delta)
+                {
+                    for (size_t k = 0; k < neighbors[v].size(); ++k)
+                    {
+                        int u = neighbors[v][k];
+                        change(u, delta);
+                        if (neighbors[u].size() > hubDegree)
+                        {
+                            continue;
+                        }
+                        for (size_t j = 0; j < neighbors[u].size(); ++j)
+                        {
+                            if (neighbors[u][j] != v)
+                            {
+                                change(neighbors[u][j], delta);
+                            }
+                        }
+                    }
+                };
+
+            //      ,      
+            std::vector<int> seeds = byDegreeDescending(neighbors);
+            size_t nextSeed = 0;
+            while ((int)order.size() < n)
+            {
+                while (top > 0 && bucket[top] == -1)
+                {
+                    --top;
+                }
+                int chosen;
+                if (top > 0)
+                {
+                    chosen = bucket[top];
+                    unlink(chosen);
+                }
+                else
+                {
+                    while (placed[seeds[nextSeed]])
+                    {
+                        ++nextSeed;
+                    }
+                    chosen = seeds[nextSeed];
+                }
+
+                placed[chosen] = true;
+                order.push_back(chosen);
+                adjust(chosen, 1);
+                if ((int)order.size() > window)
+                {
+                    adjust(order[order.size() - 1 - window], -1);
+                }
+            }
+            return order;
+        }
+    }
+}
+
+#endif // GRAPH_REORDERING_HPP
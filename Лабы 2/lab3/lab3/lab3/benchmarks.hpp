@@ -0,0 +1,438 @@
+// benchmarks.hpp
+//      (: lab3 --bench [ ] [cc|io|bfs|order]).
+//    CSV: lab3 --bench [  ] suite [.csv]
+
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include "GraphAlgorithms.hpp"
+#include "GraphIO.hpp"
+#include "GraphGenerators.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace GraphBenchmarks
+{
+    using namespace GraphAlgorithms;
+
+    //     
+    template<typename Func>
+    double measureSeconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    inline void printTiming(const std::string& name, double seconds, long long edges)
+    {
+        std::cout << "  " << std::left << std::setw(40) << name
+            << std::right << std::fixed << std::setprecision(3) << seconds << " c, "
+            << std::setprecision(1) << (seconds > 0 ? edges / seconds / 1e6 : 0.0) << "  /\n";
+    }
+
+    //  R-MAT   16   
+    inline int rmatScaleFor(long long edgeCount)
+    {
+        int scale = 1;
+        while (scale < 30 && (16LL << (scale + 1)) <= edgeCount)
+        {
+            ++scale;
+        }
+        return scale;
+    }
+
+    //     : DFS,  , Afforest  union-find   
+    inline void benchmarkConnectedComponents(long long edgeCount)
+    {
+        int vertexCount = (int)std::max(1LL, edgeCount / 10);
+        std::cout << " : " << vertexCount << " , " << edgeCount << " \n";
+
+        std::mt19937_64 rng(2024);
+        std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+        std::vector<std::pair<int, int>> edges((size_t)edgeCount);
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            edges[i] = std::make_pair(vertex(rng), vertex(rng));
+        }
+
+        Graph g(vertexCount, false);
+        double buildTime = measureSeconds([&]()
+            {
+                for (size_t i = 0; i < edges.size(); ++i)
+                {
+                    g.addUndirectedEdge(edges[i].first, edges[i].second);
+                }
+            });
+        printTiming("  ", buildTime, edgeCount);
+
+        size_t sink = 0;
+        printTiming("connectedComponents (DFS)", measureSeconds([&]() { sink += g.connectedComponents().size(); }), edgeCount);
+        printTiming("componentLabels (BFS)", measureSeconds([&]() { sink += g.componentLabels().count; }), edgeCount);
+        printTiming("connectedComponentsParallel, 1 ", measureSeconds([&]() { sink += g.connectedComponentsParallel(1).count; }), edgeCount);
+        printTiming("connectedComponentsParallel", measureSeconds([&]() { sink += g.connectedComponentsParallel().count; }), edgeCount);
+        printTiming("connectedComponentsOfEdges", measureSeconds([&]() { sink += connectedComponentsOfEdges(vertexCount, edges).count; }), edgeCount);
+        std::cout << "  (  " << sink << ")\n";
+    }
+
+    //   :       CSR   
+    inline void benchmarkLoaders(long long edgeCount)
+    {
+        const std::string textPath = "lab3_bench_edges.txt";
+        const std::string snapshotPath = "lab3_bench_edges.bin";
+        int vertexCount = (int)std::max(1LL, edgeCount / 10);
+
+        {
+            std::mt19937_64 rng(7);
+            std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+            std::uniform_real_distribution<double> weight(0.0, 100.0);
+            std::ofstream out(textPath, std::ios::binary);
+            std::string line;
+            for (long long i = 0; i < edgeCount; ++i)
+            {
+                line = std::to_string(vertex(rng));
+                line += ' ';
+                line += std::to_string(vertex(rng));
+                line += ' ';
+                line += std::to_string(weight(rng));
+                line += '\n';
+                out << line;
+            }
+        }
+
+        size_t bytes = 0;
+        double readTime = measureSeconds([&]()
+            {
+                std::ifstream in(textPath, std::ios::binary);
+                std::vector<char> buffer(1 << 22);
+                while (in.read(buffer.data(), buffer.size()) || in.gcount() > 0)
+                {
+                    bytes += (size_t)in.gcount();
+                }
+            });
+        std::cout << " : " << edgeCount << " , " << bytes / (1 << 20) << "  \n";
+        printTiming("  ", readTime, edgeCount);
+
+        CsrGraph csr;
+        printTiming("loadEdgeList, 1 ", measureSeconds([&]() { csr = loadEdgeList(textPath, 1); }), edgeCount);
+        printTiming("loadEdgeList", measureSeconds([&]() { csr = loadEdgeList(textPath); }), edgeCount);
+        printTiming("saveSnapshot", measureSeconds([&]() { saveSnapshot(csr, snapshotPath); }), edgeCount);
+        printTiming("loadSnapshot", measureSeconds([&]() { csr = loadSnapshot(snapshotPath); }), edgeCount);
+
+        std::remove(textPath.c_str());
+        std::remove(snapshotPath.c_str());
+    }
+
+    //      R-MAT (16   ):    
+    inline void benchmarkBfs(long long edgeCount)
+    {
+        int scale = rmatScaleFor(edgeCount);
+        int vertexCount = 1 << scale;
+        std::cout << "    R-MAT: " << vertexCount << " , " << edgeCount << " \n";
+
+        std::vector<std::pair<int, int>> edges;
+        printTiming("  R-MAT", measureSeconds([&]() { edges = rmatEdges(scale, edgeCount, 2024); }), edgeCount);
+        Graph g(0, false);
+        printTiming("  ", measureSeconds([&]() { g = makeUndirectedGraph(vertexCount, edges); }), edgeCount);
+
+        //     ,      
+        const int roots = 8;
+        std::vector<int> sources(roots);
+        std::mt19937_64 rng(99);
+        for (int k = 0; k < roots; ++k)
+        {
+            sources[k] = edges[rng() % edges.size()].first;
+        }
+        std::vector<std::pair<int, int>>().swap(edges);
+
+        long long reached = 0;
+        long long sink = 0;
+        double queueTime = measureSeconds([&]()
+            {
+                for (int k = 0; k < roots; ++k)
+                {
+                    std::vector<int> dist = g.hopDistances(sources[k]);
+                    reached += std::count_if(dist.begin(), dist.end(), [](int d) { return d >= 0; });
+                }
+            });
+        printTiming("hopDistances ()", queueTime, edgeCount * roots);
+        printTiming("hopDistancesParallel, 1 ", measureSeconds([&]()
+            {
+                for (int k = 0; k < roots; ++k)
+                {
+                    sink += g.hopDistancesParallel(sources[k], 1)[sources[k]];
+                }
+            }), edgeCount * roots);
+        printTiming("hopDistancesParallel", measureSeconds([&]()
+            {
+                for (int k = 0; k < roots; ++k)
+                {
+                    sink += g.hopDistancesParallel(sources[k])[sources[k]];
+                }
+            }), edgeCount * roots);
+        std::cout << "  (   " << reached / roots << " ,   " << sink << ")\n";
+    }
+
+    //    R-MAT   :   
+    //   (BFS   ,  )   
+    inline void benchmarkReordering(long long edgeCount)
+    {
+        int scale = rmatScaleFor(edgeCount);
+        int vertexCount = 1 << scale;
+        std::cout << "  R-MAT: " << vertexCount << " , " << edgeCount << " \n";
+
+        std::vector<std::pair<int, int>> edges = rmatEdges(scale, edgeCount, 2024);
+        Graph original = makeUndirectedGraph(vertexCount, edges);
+        const int roots = 8;
+        std::vector<int> sources(roots);
+        std::mt19937_64 rng(99);
+        for (int k = 0; k < roots; ++k)
+        {
+            sources[k] = edges[rng() % edges.size()].first;
+        }
+        std::vector<std::pair<int, int>>().swap(edges);
+
+        const char* names[] = { " ", "RCM", "  ", "Gorder" };
+        const VertexOrder methods[] = { VertexOrder::REVERSE_CUTHILL_MCKEE, VertexOrder::DEGREE_DESCENDING, VertexOrder::GORDER };
+        long long sink = 0;
+        for (int m = 0; m < 4; ++m)
+        {
+            std::cout << " " << names[m] << ":\n";
+            Graph g(0, false);
+            VertexPermutation p;
+            if (m == 0)
+            {
+                std::vector<int> identity(vertexCount);
+                for (int v = 0; v < vertexCount; ++v)
+                {
+                    identity[v] = v;
+                }
+                g = original;
+                p = VertexPermutation(identity);
+            }
+            else
+            {
+                printTiming(" ", measureSeconds([&]() { p = original.vertexOrdering(methods[m - 1]); }), edgeCount);
+                printTiming(" ", measureSeconds([&]() { g = original.relabeled(p); }), edgeCount);
+            }
+
+            printTiming("hopDistances ()", measureSeconds([&]()
+                {
+                    for (int k = 0; k < roots; ++k)
+                    {
+                        sink += g.hopDistances(p.newId[sources[k]])[p.newId[sources[k]]];
+                    }
+                }), edgeCount * roots);
+            printTiming("hopDistancesParallel", measureSeconds([&]()
+                {
+                    for (int k = 0; k < roots; ++k)
+                    {
+                        sink += g.hopDistancesParallel(p.newId[sources[k]])[p.newId[sources[k]]];
+                    }
+                }), edgeCount * roots);
+            printTiming("componentLabels (BFS)", measureSeconds([&]() { sink += g.componentLabels().count; }), edgeCount);
+        }
+        std::cout << "  (  " << sink << ")\n";
+    }
+
+    //        (   ,   )
+    inline double peakResidentMegabytes()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return counters.PeakWorkingSetSize / 1048576.0;
+        }
+        return 0.0;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0.0;
+        }
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1048576.0;  //  
+#else
+        return usage.ru_maxrss / 1024.0;     //  
+#endif
+#endif
+    }
+
+    //   :      10^4, 10^5, ...  maxEdges ,
+    //       .   CSV: ,  ,
+    // ,  , ,        .
+    //     run(...)    .   
+    inline long long benchmarkSuite(long long maxEdges, std::ostream& csv)
+    {
+        const int threads = defaultThreadCount();
+        long long sink = 0;
+        csv << "family,vertices,edges,algorithm,threads,seconds,medges_per_s,peak_rss_mb\n";
+
+        for (long long tier = 10000; tier <= maxEdges; tier *= 10)
+        {
+            std::string family;
+            int vertexCount = 0;
+            long long edgeCount = 0;
+            auto run = [&](const std::string& algorithm, int threadCount, const std::function<void()>& body)
+                {
+                    double seconds = measureSeconds(body);
+                    csv << family << ',' << vertexCount << ',' << edgeCount << ',' << algorithm << ','
+                        << threadCount << ',' << std::fixed << std::setprecision(4) << seconds << ','
+                        << std::setprecision(2) << (seconds > 0 ? edgeCount / seconds / 1e6 : 0.0) << ','
+                        << std::setprecision(1) << peakResidentMegabytes() << '\n';
+                    csv.flush();
+                };
+
+            //   :      
+            for (int kind = 0; kind < 2; ++kind)
+            {
+                std::vector<std::pair<int, int>> edges;
+                Graph g(0, false);
+                if (kind == 0)
+                {
+                    family = "erdos_renyi";
+                    vertexCount = (int)std::max(2LL, tier / 8);
+                }
+                else
+                {
+                    family = "rmat";
+                    vertexCount = 1 << rmatScaleFor(tier);
+                }
+                edgeCount = tier;
+                run("build", threads, [&]()
+                    {
+                        edges = kind == 0 ? erdosRenyiEdges(vertexCount, tier, tier) : rmatEdges(rmatScaleFor(tier), tier, tier);
+                        g = makeUndirectedGraph(vertexCount, edges);
+                    });
+                int source = edges[0].first;
+                std::vector<std::pair<int, int>>().swap(edges);
+
+                run("connectedComponents", 1, [&]() { sink += g.connectedComponents().size(); });
+                run("componentLabels", 1, [&]() { sink += g.componentLabels().count; });
+                run("connectedComponentsParallel", threads, [&]() { sink += g.connectedComponentsParallel().count; });
+                run("hopDistances", 1, [&]() { sink += g.hopDistances(source)[source]; });
+                run("hopDistancesParallel", threads, [&]() { sink += g.hopDistancesParallel(source)[source]; });
+            }
+
+            //    :     
+            {
+                family = "erdos_renyi_directed";
+                vertexCount = (int)std::max(2LL, tier / 4);
+                edgeCount = tier;
+                Graph g(0);
+                run("build", threads, [&]() { g = makeDirectedGraph(vertexCount, erdosRenyiEdges(vertexCount, tier, tier), tier); });
+                ComponentLabels scc;
+                run("stronglyConnectedComponents", 1, [&]() { scc = g.stronglyConnectedComponents(); });
+                run("stronglyConnectedComponentsParallel", threads, [&]() { sink += g.stronglyConnectedComponentsParallel().count; });
+                run("condensation", 1, [&]() { sink += g.condensation(scc).topologicalSort().size(); });
+            }
+
+            //    :  
+            {
+                family = "grid";
+                int side = (int)std::max(2.0, std::sqrt(tier / 4.0));
+                vertexCount = side * side;
+                edgeCount = 4LL * side * (side - 1);
+                Graph g(0);
+                run("build", 1, [&]() { g = gridGraph(side, side, tier); });
+                run("shortestPaths", 1, [&]() { sink += (long long)g.shortestPaths(0)[vertexCount - 1]; });
+            }
+
+            //  DAG:     
+            {
+                family = "dag";
+                vertexCount = (int)std::max(2LL, tier / 8);
+                edgeCount = tier;
+                Graph g(0);
+                run("build", 1, [&]() { g = randomDag(vertexCount, tier, tier); });
+                int source = 0;
+                run("topologicalSort", 1, [&]() { source = g.topologicalSort()[0]; });
+                run("topologicalLevels", threads, [&]() { sink += g.topologicalLevels().levelCount(); });
+                //      ,       
+                run("shortestPaths", 1, [&]()
+                    {
+                        std::vector<double> dist = g.shortestPaths(source);
+                        sink += std::count_if(dist.begin(), dist.end(), [](double d) { return !std::isinf(d); });
+                    });
+            }
+        }
+        return sink;
+    }
+
+    //  :   --bench    (  10^8),  
+    //    suite    CSV (   )
+    inline int runBenchmarks(int argc, char* argv[])
+    {
+        long long edgeCount = 100000000LL;
+        if (argc > 2)
+        {
+            edgeCount = std::atoll(argv[2]);
+        }
+        std::string only = argc > 3 ? argv[3] : "";
+
+        if (only == "suite")
+        {
+            long long sink;
+            if (argc > 4)
+            {
+                std::ofstream csv(argv[4]);
+                if (!csv)
+                {
+                    std::cerr << "    " << argv[4] << "\n";
+                    return 1;
+                }
+                sink = benchmarkSuite(edgeCount, csv);
+            }
+            else
+            {
+                sink = benchmarkSuite(edgeCount, std::cout);
+            }
+            std::cerr << " : " << sink << "\n";
+            return 0;
+        }
+
+        std::cout << "===   (: " << defaultThreadCount() << ") ===\n\n";
+        if (only.empty() || only == "cc")
+        {
+            benchmarkConnectedComponents(edgeCount);
+        }
+        if (only.empty() || only == "io")
+        {
+            benchmarkLoaders(edgeCount);
+        }
+        if (only.empty() || only == "bfs")
+        {
+            benchmarkBfs(edgeCount);
+        }
+        if (only.empty() || only == "order")
+        {
+            benchmarkReordering(edgeCount);
+        }
+        return 0;
+    }
+}
+
+#endif // BENCHMARKS_HPP
@@ -3,6 +3,7 @@
 
 #include "GraphAlgorithms.hpp"
 #include "tests.hpp"
+#include "benchmarks.hpp"
 #include <iostream>
 #include <iomanip>
 
@@ -92,8 +93,13 @@ void demonstrateAlgorithms()
     }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+    // Режим замеров производительности
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+    {
+        return GraphBenchmarks::runBenchmarks(argc, argv);
+    }
 
     // Запуск тестов
     bool testsPassed = runAllTests();
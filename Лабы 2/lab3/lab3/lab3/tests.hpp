@@ -5,10 +5,23 @@
 #define TESTS_HPP
 
 #include "GraphAlgorithms.hpp"
+#include "DagScheduler.hpp"
+#include "DynamicGraph.hpp"
+#include "GraphIO.hpp"
+#include "GraphGenerators.hpp"
 #include <cassert>
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <random>
+#include <atomic>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 
 using namespace GraphAlgorithms;
 
@@ -292,6 +305,858 @@ inline bool testDijkstraWithPositiveWeights()
     return true;
 }
 
+//  11:       
+inline bool testShortestPathsBatch()
+{
+    std::cout << " 11:    ... ";
+
+    Graph g(6);
+    g.addDirectedEdge(0, 1, 7);
+    g.addDirectedEdge(0, 2, 9);
+    g.addDirectedEdge(0, 5, 14);
+    g.addDirectedEdge(1, 2, 10);
+    g.addDirectedEdge(1, 3, 15);
+    g.addDirectedEdge(2, 3, 11);
+    g.addDirectedEdge(2, 5, 2);
+    g.addDirectedEdge(3, 4, 6);
+    g.addDirectedEdge(4, 5, 9);
+
+    std::vector<int> sources = { 0, 1, 2, 3, 4, 5, 0 };
+
+    for (int threads = 1; threads <= 4; threads *= 2)
+    {
+        DistanceMatrix batch = g.shortestPathsBatch(sources, threads);
+        assert(batch.rows == (int)sources.size());
+        assert(batch.cols == 6);
+
+        for (size_t k = 0; k < sources.size(); ++k)
+        {
+            auto dist = g.shortestPaths(sources[k]);
+            for (int v = 0; v < 6; ++v)
+            {
+                if (std::isfinite(dist[v]))
+                {
+                    assert(testDoubleEquals(batch.at((int)k, v), (float)dist[v]));
+                }
+                else
+                {
+                    assert(!std::isfinite(batch.at((int)k, v)));
+                }
+            }
+        }
+    }
+
+    DistanceMatrix empty = g.shortestPathsBatch(std::vector<int>());
+    assert(empty.rows == 0);
+
+    bool hasException = false;
+    try
+    {
+        g.shortestPathsBatch(std::vector<int>(1, 6));
+    }
+    catch (const std::out_of_range&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  12:     ( DFS   )
+inline bool testConnectedComponentsLongChain()
+{
+    std::cout << " 12:     ... ";
+
+    const int n = 1000000;
+    Graph g(n, false);
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        g.addUndirectedEdge(i, i + 1);
+    }
+
+    auto components = g.connectedComponents();
+    assert(components.size() == 1);
+    assert(components[0].size() == (size_t)n);
+    for (int i = 0; i < n; ++i)
+    {
+        assert(components[0][i] == i);
+    }
+
+    ComponentLabels labels = g.componentLabels();
+    assert(labels.count == 1);
+
+    ComponentLabels parallel = g.connectedComponentsParallel(4);
+    assert(parallel.count == 1);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+// ,       ,   connectedComponents
+inline void checkLabelsMatch(const std::vector<std::vector<int>>& components, const ComponentLabels& labels)
+{
+    assert(labels.count == (int)components.size());
+    for (size_t c = 0; c < components.size(); ++c)
+    {
+        for (size_t j = 0; j < components[c].size(); ++j)
+        {
+            assert(labels.label[components[c][j]] == (int)c);
+        }
+    }
+
+    ComponentGroups groups = labels.grouped();
+    assert(groups.count() == labels.count);
+    for (int c = 0; c < groups.count(); ++c)
+    {
+        std::vector<int> expected = components[c];
+        std::sort(expected.begin(), expected.end());
+        assert(std::equal(groups.begin(c), groups.end(c), expected.begin(), expected.end()));
+    }
+}
+
+//  13:       connectedComponents
+inline bool testConnectedComponentsParallel()
+{
+    std::cout << " 13:   ... ";
+
+    std::mt19937 rng(42);
+    const int n = 20000;
+    for (int edgesCount = 0; edgesCount <= 20000; edgesCount += 5000)
+    {
+        Graph g(n, false);
+        std::vector<std::pair<int, int>> edges;
+        std::uniform_int_distribution<int> vertex(0, n - 1);
+        for (int i = 0; i < edgesCount; ++i)
+        {
+            int u = vertex(rng);
+            int v = vertex(rng);
+            g.addUndirectedEdge(u, v);
+            edges.push_back(std::make_pair(u, v));
+        }
+
+        auto components = g.connectedComponents();
+        checkLabelsMatch(components, g.componentLabels());
+        checkLabelsMatch(components, g.connectedComponentsParallel(1));
+        checkLabelsMatch(components, g.connectedComponentsParallel(4));
+        checkLabelsMatch(components, connectedComponentsOfEdges(n, edges, 4));
+    }
+
+    //      :     
+    Graph weighted(3);
+    weighted.addDirectedEdge(0, 1, 1.0);
+    assert(weighted.componentLabels().count == 3);
+    assert(weighted.connectedComponentsParallel(2).count == 3);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  DAG:        
+inline Graph makeRandomDag(int n, int edgesCount, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    Graph g(n);
+    for (int i = 0; i < edgesCount; ++i)
+    {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        if (u != v)
+        {
+            g.addDirectedEdge(std::min(u, v), std::max(u, v));
+        }
+    }
+    return g;
+}
+
+//  14:    
+inline bool testTopologicalLevels()
+{
+    std::cout << " 14:    ... ";
+
+    Graph g(6);
+    g.addDirectedEdge(5, 2);
+    g.addDirectedEdge(5, 0);
+    g.addDirectedEdge(4, 0);
+    g.addDirectedEdge(4, 1);
+    g.addDirectedEdge(2, 3);
+    g.addDirectedEdge(3, 1);
+
+    TopologicalLevels levels = g.topologicalLevels(2);
+    assert(levels.order.size() == 6);
+    assert(levels.levelCount() == 4);  // {4, 5}, {0, 2}, {3}, {1}
+    assert(levels.levelSize(0) == 2);
+    assert(levels.levelSize(1) == 2);
+    assert(levels.levelSize(2) == 1);
+    assert(levels.levelSize(3) == 1);
+
+    for (int threads = 1; threads <= 4; threads *= 2)
+    {
+        Graph dag = makeRandomDag(3000, 15000, 7);
+        TopologicalLevels random = dag.topologicalLevels(threads);
+        assert(random.order.size() == 3000);
+
+        std::vector<int> level(3000, -1);
+        for (int l = 0; l < random.levelCount(); ++l)
+        {
+            for (const int* it = random.begin(l); it != random.end(l); ++it)
+            {
+                level[*it] = l;
+            }
+        }
+        for (int u = 0; u < 3000; ++u)
+        {
+            for (const auto& edge : dag.getOutEdges(u))
+            {
+                assert(level[u] < level[edge.first]);
+            }
+        }
+    }
+
+    Graph cycle(3);
+    cycle.addDirectedEdge(0, 1);
+    cycle.addDirectedEdge(1, 2);
+    cycle.addDirectedEdge(2, 0);
+    bool hasException = false;
+    try
+    {
+        cycle.topologicalLevels();
+    }
+    catch (const std::runtime_error&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  15:    DAG   
+inline bool testDagExecutor()
+{
+    std::cout << " 15:    DAG... ";
+
+    const int n = 2000;
+    Graph dag = makeRandomDag(n, 8000, 11);
+
+    for (int threads = 1; threads <= 4; threads *= 2)
+    {
+        std::atomic<int> clock(0);
+        std::vector<int> started(n, -1);
+        std::vector<int> finished(n, -1);
+
+        executeDag(dag, [&](int v)
+            {
+                started[v] = clock.fetch_add(1);
+                finished[v] = clock.fetch_add(1);
+            }, threads);
+
+        for (int u = 0; u < n; ++u)
+        {
+            assert(started[u] != -1);
+            for (const auto& edge : dag.getOutEdges(u))
+            {
+                assert(finished[u] < started[edge.first]);
+            }
+        }
+    }
+
+    Graph cycle(4);
+    cycle.addDirectedEdge(0, 1);
+    cycle.addDirectedEdge(1, 2);
+    cycle.addDirectedEdge(2, 1);
+    std::atomic<int> executed(0);
+    bool hasException = false;
+    try
+    {
+        executeDag(cycle, [&](int) { executed++; }, 2);
+    }
+    catch (const std::runtime_error&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+    assert(executed == 2);  //  0  3  
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//          
+inline void checkRepairedPaths(DynamicGraph& dynamic, int source)
+{
+    const std::vector<double>& repaired = dynamic.shortestPaths(source);
+    std::vector<double> expected = dynamic.toGraph().shortestPaths(source);
+    const std::vector<int>& parent = dynamic.shortestPathTree();
+
+    for (int v = 0; v < dynamic.getVertexCount(); ++v)
+    {
+        if (!std::isfinite(expected[v]))
+        {
+            assert(!std::isfinite(repaired[v]));
+            assert(parent[v] == -1);
+            continue;
+        }
+        assert(std::fabs(repaired[v] - expected[v]) < 1e-6);
+        if (v != source)
+        {
+            int p = parent[v];
+            assert(p != -1 && dynamic.hasEdge(p, v));
+        }
+    }
+}
+
+//  16:    
+inline bool testDynamicShortestPaths()
+{
+    std::cout << " 16:    ... ";
+
+    //  :      
+    Graph g(4);
+    g.addDirectedEdge(0, 1, 1.0);
+    g.addDirectedEdge(1, 2, 1.0);
+    g.addDirectedEdge(0, 2, 5.0);
+    g.addDirectedEdge(2, 3, 1.0);
+
+    DynamicGraph dynamic(g);
+    assert(testDoubleEquals(dynamic.shortestPaths(0)[3], 3.0));
+
+    dynamic.removeEdge(1, 2);
+    assert(testDoubleEquals(dynamic.shortestPaths(0)[3], 6.0));
+    assert(dynamic.shortestPathTree()[2] == 0);
+
+    dynamic.updateWeight(0, 2, 0.5);
+    assert(testDoubleEquals(dynamic.shortestPaths(0)[3], 1.5));
+
+    dynamic.removeEdge(0, 2);
+    assert(!std::isfinite(dynamic.shortestPaths(0)[3]));
+
+    //      ,      
+    Graph multi(3);
+    multi.addDirectedEdge(0, 1, 2.0);
+    multi.addDirectedEdge(0, 1, 7.0);
+    multi.addDirectedEdge(1, 2, 1.0);
+    multi.addDirectedEdge(1, 2, 0.5);
+    multi.addDirectedEdge(1, 2, 4.0);
+    DynamicGraph merged(multi);
+    std::vector<double> direct = multi.shortestPaths(0);
+    assert(testDoubleEquals(merged.shortestPaths(0)[2], 2.5));
+    assert(testDoubleEquals(merged.shortestPaths(0)[2], direct[2]));
+    checkRepairedPaths(merged, 0);
+
+    //         
+    const int n = 300;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    std::uniform_real_distribution<double> weight(0.1, 10.0);
+    std::uniform_int_distribution<int> operation(0, 3);
+
+    DynamicGraph random(n);
+    for (int i = 0; i < 1200; ++i)
+    {
+        random.insertEdge(vertex(rng), vertex(rng), weight(rng));
+    }
+    random.shortestPaths(0);
+
+    for (int step = 0; step < 600; ++step)
+    {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        switch (operation(rng))
+        {
+        case 0:
+            random.insertEdge(u, v, weight(rng));
+            break;
+        case 1:
+            random.removeEdge(u, v);
+            break;
+        default:
+            if (random.hasEdge(u, v))
+            {
+                random.updateWeight(u, v, weight(rng));
+            }
+            else
+            {
+                //    
+                int target = vertex(rng);
+                int p = random.shortestPathTree()[target];
+                if (p != -1)
+                {
+                    random.removeEdge(p, target);
+                }
+            }
+            break;
+        }
+        checkRepairedPaths(random, 0);
+    }
+
+    bool hasException = false;
+    try
+    {
+        random.insertEdge(0, 1, -1.0);
+    }
+    catch (const std::invalid_argument&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  17:        
+inline bool testGraphLoaders()
+{
+    std::cout << " 17:    ... ";
+
+    std::string dimacs =
+        "c   DIMACS\n"
+        "p sp 4 5\n"
+        "a 1 2 7\n"
+        "a 1 3 9\n"
+        "a 2 3 1\n"
+        "a 3 4 2\r\n"
+        "a 2 4 15\n";
+    CsrGraph gr = parseDimacs(dimacs.data(), dimacs.size(), 2);
+    assert(gr.vertexCount == 4);
+    assert(gr.edgeCount() == 5);
+    assert(gr.isWeighted());
+    assert(gr.degree(0) == 2 && gr.targets[0] == 1 && gr.targets[1] == 2);
+    auto dist = gr.toGraph().shortestPaths(0);
+    assert(testDoubleEquals(dist[3], 10.0));  // 0->1->2->3
+
+    std::string market =
+        "%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "% \n"
+        "5 5 3\n"
+        "2 1\n"
+        "3 2\n"
+        "5 4\n";
+    CsrGraph mm = parseMatrixMarket(market.data(), market.size(), 2);
+    assert(mm.vertexCount == 5);
+    assert(mm.edgeCount() == 6);
+    assert(!mm.isWeighted());
+    assert(mm.hasArc(0, 1) && mm.hasArc(1, 0) && mm.hasArc(4, 3));
+    auto components = mm.toUndirectedGraph().connectedComponents();
+    assert(components.size() == 2);
+
+    //           
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> vertex(0, 9999);
+    std::string edges = "#  \n";
+    for (int i = 0; i < 200000; ++i)
+    {
+        edges += std::to_string(vertex(rng)) + " " + std::to_string(vertex(rng));
+        edges += (i % 2 == 0) ? " 2.5\n" : "\t1e0\n";
+    }
+    CsrGraph single = parseEdgeList(edges.data(), edges.size(), 1);
+    CsrGraph parallel = parseEdgeList(edges.data(), edges.size(), 4);
+    assert(single.edgeCount() == 200000);
+    assert(single.offsets == parallel.offsets);
+    assert(single.targets == parallel.targets);
+    assert(single.weights == parallel.weights);
+
+    //     
+    const std::string path = "lab3_snapshot_test.bin";
+    saveSnapshot(parallel, path);
+    CsrGraph restored = loadSnapshot(path);
+    std::remove(path.c_str());
+    assert(restored.vertexCount == parallel.vertexCount);
+    assert(restored.offsets == parallel.offsets);
+    assert(restored.targets == parallel.targets);
+    assert(restored.weights == parallel.weights);
+
+    //  :   ,       int
+    const std::pair<CsrGraph(*)(const char*, size_t, int), std::string> broken[] =
+    {
+        { parseDimacs, "p sp 2 1\na 1 x 3\n" },
+        { parseDimacs, "p sp 4294967298 1\na 1 2 3\n" },
+        { parseDimacs, "p sp -1 1\na 1 2 3\n" },
+        { parseEdgeList, "0 4294967297\n" },
+        { parseEdgeList, "-4294967295 0\n" },
+        { parseMatrixMarket, "%%MatrixMarket matrix coordinate pattern general\n2 4294967298 1\n1 2\n" },
+        { parseMatrixMarket, "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n4294967298 1\n" },
+        { parseMatrixMarket, "%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n2 1 3\n" },
+        { parseMatrixMarket, "%%MatrixMarket matrix coordinate complex hermitian\n2 2 1\n2 1 3 1\n" }
+    };
+    for (const auto& file : broken)
+    {
+        bool hasException = false;
+        try
+        {
+            file.first(file.second.data(), file.second.size(), 0);
+        }
+        catch (const std::runtime_error&)
+        {
+            hasException = true;
+        }
+        assert(hasException);
+    }
+
+    //  :  ,   offset,    .
+    //  0 -> 1 -> 2: offsets = { 0, 1, 2, 2 }   32, targets = { 1, 2 }  
+    std::string pathList = "0 1\n1 2\n";
+    saveSnapshot(parseEdgeList(pathList.data(), pathList.size()), path);
+    std::string image;
+    {
+        std::ifstream in(path, std::ios::binary);
+        image.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const size_t offsetsAt = 32;
+    const size_t targetsAt = offsetsAt + 4 * sizeof(std::uint64_t);
+    const std::pair<size_t, std::uint64_t> patches[] =
+    {
+        { offsetsAt + 1 * sizeof(std::uint64_t), 5 },
+        { offsetsAt + 3 * sizeof(std::uint64_t), 1 },
+        { offsetsAt, 1 }
+    };
+    for (int k = 0; k < 4; ++k)
+    {
+        std::string corrupt = image;
+        if (k < 3)
+        {
+            std::memcpy(&corrupt[patches[k].first], &patches[k].second, sizeof(std::uint64_t));
+        }
+        else
+        {
+            int target = 7;
+            std::memcpy(&corrupt[targetsAt], &target, sizeof(int));
+        }
+        {
+            std::ofstream out(path, std::ios::binary);
+            out.write(corrupt.data(), corrupt.size());
+        }
+        bool hasException = false;
+        try
+        {
+            loadSnapshot(path);
+        }
+        catch (const std::runtime_error&)
+        {
+            hasException = true;
+        }
+        assert(hasException);
+    }
+    std::remove(path.c_str());
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  18: BFS        ,    R-MAT
+inline bool testHopDistances()
+{
+    std::cout << " 18: BFS   ... ";
+
+    //  0-1-2-3    4-5
+    Graph small(6, false);
+    small.addUndirectedEdge(0, 1);
+    small.addUndirectedEdge(1, 2);
+    small.addUndirectedEdge(2, 3);
+    small.addUndirectedEdge(4, 5);
+    std::vector<int> expected = { 0, 1, 2, 3, -1, -1 };
+    assert(small.hopDistances(0) == expected);
+    assert(small.hopDistancesParallel(0, 2) == expected);
+
+    // :               
+    Graph star(5000, false);
+    for (int v = 1; v < 5000; ++v)
+    {
+        star.addUndirectedEdge(0, v);
+        star.addUndirectedEdge(v, v % 4999 + 1);
+    }
+    assert(star.hopDistancesParallel(7, 4) == star.hopDistances(7));
+
+    //  R-MAT      
+    std::vector<std::pair<int, int>> edges = rmatEdges(12, 1 << 15, 5);
+    Graph rmat = makeUndirectedGraph(1 << 12, edges);
+    for (int k = 0; k < 5; ++k)
+    {
+        int source = edges[k * 1000].first;
+        std::vector<int> reference = rmat.hopDistances(source);
+        assert(rmat.hopDistancesParallel(source, 1) == reference);
+        assert(rmat.hopDistancesParallel(source, 4) == reference);
+    }
+
+    //      
+    Graph weighted(3);
+    weighted.addDirectedEdge(0, 1, 1.0);
+    std::vector<int> lonely = { 0, -1, -1 };
+    assert(weighted.hopDistancesParallel(0) == lonely);
+
+    bool hasException = false;
+    try
+    {
+        small.hopDistancesParallel(6);
+    }
+    catch (const std::out_of_range&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//       (   )
+inline std::vector<std::vector<int>> canonicalComponents(std::vector<std::vector<int>> components)
+{
+    for (size_t c = 0; c < components.size(); ++c)
+    {
+        std::sort(components[c].begin(), components[c].end());
+    }
+    std::sort(components.begin(), components.end());
+    return components;
+}
+
+//  19:    ,    
+inline bool testVertexReordering()
+{
+    std::cout << " 19:  ... ";
+
+    //    :  RCM      
+    const int n = 200;
+    std::vector<int> shuffled(n);
+    for (int i = 0; i < n; ++i)
+    {
+        shuffled[i] = i;
+    }
+    std::mt19937 rng(8);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    Graph path(n, false);
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        path.addUndirectedEdge(shuffled[i], shuffled[i + 1]);
+    }
+    VertexPermutation rcm = path.vertexOrdering(VertexOrder::REVERSE_CUTHILL_MCKEE);
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        assert(std::abs(rcm.newId[shuffled[i]] - rcm.newId[shuffled[i + 1]]) == 1);
+    }
+
+    const VertexOrder methods[] = { VertexOrder::REVERSE_CUTHILL_MCKEE, VertexOrder::DEGREE_DESCENDING, VertexOrder::GORDER };
+
+    //  :         
+    std::vector<std::pair<int, int>> edges = rmatEdges(10, 4000, 21);
+    Graph rmat = makeUndirectedGraph(1 << 10, edges);
+    int source = edges[0].first;
+    std::vector<int> hops = rmat.hopDistances(source);
+    std::vector<std::vector<int>> components = canonicalComponents(rmat.connectedComponents());
+    for (VertexOrder method : methods)
+    {
+        VertexPermutation p = rmat.vertexOrdering(method);
+        for (int v = 0; v < p.size(); ++v)
+        {
+            assert(p.oldId[p.newId[v]] == v);
+        }
+        Graph relabeled = rmat.relabeled(p);
+        assert(p.valuesToOriginal(relabeled.hopDistances(p.newId[source])) == hops);
+        assert(p.valuesToOriginal(relabeled.hopDistancesParallel(p.newId[source], 2)) == hops);
+        assert(canonicalComponents(p.groupsToOriginal(relabeled.connectedComponents())) == components);
+
+        ComponentLabels labels = relabeled.componentLabels();
+        std::vector<int> label = p.valuesToOriginal(labels.label);
+        std::vector<std::vector<int>> byLabel(labels.count);
+        for (int v = 0; v < p.size(); ++v)
+        {
+            byLabel[label[v]].push_back(v);
+        }
+        assert(canonicalComponents(byLabel) == components);
+    }
+
+    //  DAG:     
+    Graph dag = makeRandomDag(500, 3000, 4);
+    std::vector<double> dist = dag.shortestPaths(0);
+    for (VertexOrder method : methods)
+    {
+        Graph copy = dag;
+        VertexPermutation p = copy.reorder(method);
+        std::vector<double> mapped = p.valuesToOriginal(copy.shortestPaths(p.newId[0]));
+        for (int v = 0; v < 500; ++v)
+        {
+            assert(std::isinf(dist[v]) ? std::isinf(mapped[v]) : testDoubleEquals(mapped[v], dist[v]));
+        }
+
+        std::vector<int> order = p.idsToOriginal(copy.topologicalSort());
+        std::vector<int> position(500);
+        for (int i = 0; i < 500; ++i)
+        {
+            position[order[i]] = i;
+        }
+        for (int u = 0; u < 500; ++u)
+        {
+            for (const auto& edge : dag.getOutEdges(u))
+            {
+                assert(position[u] < position[edge.first]);
+            }
+        }
+    }
+
+    bool hasException = false;
+    try
+    {
+        VertexPermutation broken(std::vector<int>{ 0, 0, 1 });
+    }
+    catch (const std::invalid_argument&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  20:     seed     
+inline bool testGraphGenerators()
+{
+    std::cout << " 20:  ... ";
+
+    //     seed        
+    std::vector<std::pair<int, int>> er = erdosRenyiEdges(1000, 200000, 17, 1);
+    assert(er.size() == 200000);
+    assert(er == erdosRenyiEdges(1000, 200000, 17, 4));
+    assert(er != erdosRenyiEdges(1000, 200000, 18, 4));
+    for (size_t i = 0; i < er.size(); ++i)
+    {
+        assert(er[i].first != er[i].second);
+        assert(er[i].first >= 0 && er[i].first < 1000 && er[i].second >= 0 && er[i].second < 1000);
+    }
+    assert(rmatEdges(12, 100000, 3, 0.57, 0.19, 0.19, 1) == rmatEdges(12, 100000, 3, 0.57, 0.19, 0.19, 3));
+
+    // :      ,   1
+    const int rows = 30;
+    const int cols = 40;
+    Graph grid = gridGraph(rows, cols, 5, 10.0);
+    assert(grid.getVertexCount() == rows * cols);
+    size_t arcs = 0;
+    for (int v = 0; v < rows * cols; ++v)
+    {
+        arcs += grid.getOutEdges(v).size();
+        for (const auto& edge : grid.getOutEdges(v))
+        {
+            assert(edge.second >= 1.0 && edge.second <= 10.0);
+        }
+    }
+    assert(arcs == 2 * (size_t)(rows * (cols - 1) + cols * (rows - 1)));
+    std::vector<double> dist = grid.shortestPaths(0);
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            assert(dist[r * cols + c] >= r + c - EPSILON);
+        }
+    }
+
+    //  DAG  ,      
+    Graph dag = randomDag(2000, 10000, 9);
+    std::vector<int> order = dag.topologicalSort();
+    assert(order.size() == 2000);
+    bool shuffled = false;
+    for (int i = 0; i < 2000; ++i)
+    {
+        shuffled |= order[i] != i;
+    }
+    assert(shuffled);
+
+    bool hasException = false;
+    try
+    {
+        gridGraph(0, 5, 1);
+    }
+    catch (const std::invalid_argument&)
+    {
+        hasException = true;
+    }
+    assert(hasException);
+
+    std::cout << "OK\n";
+    return true;
+}
+
+//  21:     
+inline bool testStronglyConnectedComponents()
+{
+    std::cout << " 21:   ... ";
+
+    //  {0, 1, 2}  {3, 4},  5  ,  6  
+    Graph g(7);
+    g.addDirectedEdge(0, 1);
+    g.addDirectedEdge(1, 2);
+    g.addDirectedEdge(2, 0);
+    g.addDirectedEdge(2, 3, 5.0);
+    g.addDirectedEdge(1, 3, 2.0);
+    g.addDirectedEdge(3, 4);
+    g.addDirectedEdge(4, 3);
+    g.addDirectedEdge(4, 5);
+    g.addDirectedEdge(5, 5);
+    std::vector<int> expected = { 0, 0, 0, 1, 1, 2, 3 };
+    ComponentLabels scc = g.stronglyConnectedComponents();
+    assert(scc.count == 4);
+    assert(scc.label == expected);
+    assert(g.stronglyConnectedComponentsParallel(2).label == expected);
+
+    // :        
+    Graph dag = g.condensation(scc);
+    assert(dag.getVertexCount() == 4);
+    assert(dag.getOutEdges(0).size() == 1);
+    assert(dag.getOutEdges(0)[0].first == 1 && testDoubleEquals(dag.getOutEdges(0)[0].second, 2.0));
+    assert(dag.getOutEdges(2).empty());
+    assert(dag.topologicalSort().size() == 4);
+
+    //      (  ),       
+    const int n = 100000;
+    Graph ring(n);
+    Graph chain(n);
+    for (int v = 0; v < n; ++v)
+    {
+        ring.addDirectedEdge(v, (v + 1) % n);
+        if (v + 1 < n)
+        {
+            chain.addDirectedEdge(v, v + 1);
+        }
+    }
+    assert(ring.stronglyConnectedComponents().count == 1);
+    assert(ring.stronglyConnectedComponentsParallel(4).count == 1);
+    assert(chain.stronglyConnectedComponents().count == n);
+    assert(chain.stronglyConnectedComponentsParallel(4).count == n);
+
+    //    :     ,
+    //         
+    for (int density = 1; density <= 4; ++density)
+    {
+        const int vertices = 3000;
+        Graph random = makeDirectedGraph(vertices, erdosRenyiEdges(vertices, vertices * density / 2 + vertices / 3, density), 1);
+        ComponentLabels reference = random.stronglyConnectedComponents();
+        assert(random.stronglyConnectedComponentsParallel(1).label == reference.label);
+        assert(random.stronglyConnectedComponentsParallel(4).label == reference.label);
+
+        std::vector<int> order = random.condensation(reference).topologicalSort();
+        std::vector<int> position(reference.count);
+        for (int i = 0; i < reference.count; ++i)
+        {
+            position[order[i]] = i;
+        }
+        for (int u = 0; u < vertices; ++u)
+        {
+            for (const auto& edge : random.getOutEdges(u))
+            {
+                int cu = reference.label[u];
+                int cv = reference.label[edge.first];
+                assert(cu == cv || position[cu] < position[cv]);
+            }
+        }
+    }
+
+    std::cout << "OK\n";
+    return true;
+}
+
 //      
 inline bool runAllTests()
 {
@@ -311,6 +1176,17 @@ inline bool runAllTests()
         allPassed &= testTopologicalSortCycle();
         allPassed &= testAllAlgorithmsIntegration();
         allPassed &= testDijkstraWithPositiveWeights();
+        allPassed &= testShortestPathsBatch();
+        allPassed &= testConnectedComponentsLongChain();
+        allPassed &= testConnectedComponentsParallel();
+        allPassed &= testTopologicalLevels();
+        allPassed &= testDagExecutor();
+        allPassed &= testDynamicShortestPaths();
+        allPassed &= testGraphLoaders();
+        allPassed &= testHopDistances();
+        allPassed &= testVertexReordering();
+        allPassed &= testGraphGenerators();
+        allPassed &= testStronglyConnectedComponents();
     }
     catch (const std::exception& e)
     {
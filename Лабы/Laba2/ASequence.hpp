@@ -69,37 +69,27 @@ public:
         return array.get(index);
     }
 
-    bool operator==(const Sequence<ElementType>& other) const
+    const ElementType* GetSpan() const override
     {
-        if (GetLength() != other.GetLength())
-            return false;
-
-        for (int i = 0; i < GetLength(); ++i)
-            if (Get(i) != other.Get(i))
-                return false;
-        return true;
-    }
-
-    bool operator!=(const Sequence<ElementType>& other) const
-    {
-        return !(*this == other);
+        return array.get_data();
     }
 
     ArraySequence& operator+=(const Sequence<ElementType>& other)
     {
-        if (&other == nullptr)
-            throw std::invalid_argument("Other sequence is null");
-
-        for (int i = 0; i < other.GetLength(); ++i)
-            array.push_back(other.Get(i));
+        if (&other == this)
+        {
+            //     :  
+            DynamicArray<ElementType> items(array);
+            for (size_t i = 0; i < items.get_size(); ++i)
+                array.push_back(items[i]);
+            return *this;
+        }
+        other.ForEach([&](const ElementType& item) { array.push_back(item); });
         return *this;
     }
 
     ArraySequence& operator+=(Sequence<ElementType>&& other)
     {
-        if (&other == nullptr)
-            throw std::invalid_argument("Other sequence is null");
-
         if (auto* otherSeq = dynamic_cast<ArraySequence*>(&other))
             array.concat(std::move(otherSeq->array));
         else
@@ -162,15 +152,6 @@ public:
     //    return result;
     //}
 
-    template<typename ResultType>
-    ResultType Reduce(ResultType(*reducer)(ResultType, ElementType), ResultType initial) const
-    {
-        ResultType accumulator = initial;
-        for (int i = 0; i < GetLength(); ++i)
-            accumulator = reducer(accumulator, Get(i));
-        return accumulator;
-    }
-
 protected:
 
 };
@@ -218,6 +218,61 @@ void SequenceTests::test_destructor()
     assert(TrackedObject::counter == 0);
 }
 
+void SequenceTests::test_span_algorithms()
+{
+    int items[] = { 1, 2, 3, 4, 5 };
+    MArraySequence<int> seq(items, 5);
+
+    // Array-backed sequences expose their storage
+    const int* span = seq.GetSpan();
+    assert(span != nullptr);
+    assert(span[0] == 1 && span[4] == 5);
+
+    int sum = 0;
+    seq.ForEach(1, 4, [&](const int& x) { sum += x; });
+    assert(sum == 9);
+    assert(seq.Reduce<long long>([](long long acc, int x) { return acc + x; }, 0) == 15);
+
+    // Function pointers take the overload kept for existing callers
+    long long (*add)(long long, int) = [](long long acc, int x) { return acc + x; };
+    assert(seq.Reduce(add, 0LL) == 15);
+    add = nullptr;
+    try
+    {
+        seq.Reduce(add, 0LL);
+        assert(false);
+    }
+    catch (const std::invalid_argument&)
+    {
+    }
+
+    try
+    {
+        seq.ForEach(0, 6, [](const int&) {});
+        assert(false);
+    }
+    catch (const std::out_of_range&)
+    {
+    }
+
+    MArraySequence<int> same(items, 5);
+    MArraySequence<int> shorter(items, 4);
+    assert(seq == same);
+    assert(seq != shorter);
+    same.InsertAt(0, 2);
+    assert(seq != same);
+
+    // Appending a sequence to itself copies the original elements once
+    seq += seq;
+    assert(seq.GetLength() == 10);
+    assert(seq.Get(5) == 1 && seq.Get(9) == 5);
+
+    MArraySequence<int> empty;
+    MArraySequence<int> otherEmpty;
+    assert(empty == otherEmpty);
+    assert(empty.Reduce<int>([](int acc, int x) { return acc + x; }, 7) == 7);
+}
+
 void SequenceTests::test_all() 
 {
     test_constructors();
@@ -232,6 +287,7 @@ void SequenceTests::test_all()
     test_zip_operation();
     test_unzip_operation();
     test_destructor();
+    test_span_algorithms();
 
     std::cout << "All Sequence tests passed!\n";
 }
\ No newline at end of file
@@ -23,5 +23,6 @@ public:
     static void test_zip_operation();
     static void test_unzip_operation();
     static void test_destructor();
+    static void test_span_algorithms();
     static void test_all();
 };
@@ -0,0 +1,177 @@
+#pragma once
+#include "ASequence.hpp"
+#include "LLSequence.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+//   (: Laba2 --bench [ ])
+class Benchmarks
+{
+private:
+    static bool isEven(int x)
+    {
+        return x % 2 == 0;
+    }
+
+public:
+    template <class Func>
+    static double measure_seconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    static void print_timing(const std::string& name, double seconds, long long count)
+    {
+        std::cout << "  " << std::left << std::setw(44) << name
+            << std::right << std::fixed << std::setprecision(3) << seconds << " s, "
+            << std::setprecision(1) << (seconds > 0 ? count / seconds / 1e6 : 0.0) << " M elements/s\n";
+    }
+
+    //    Get(0), Get(1), ...:        
+    static void time_scan(const std::string& name, const Sequence<int>& sequence)
+    {
+        long long sum = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (int i = 0; i < sequence.GetLength(); ++i)
+                {
+                    sum += sequence.Get(i);
+                }
+            });
+        long long n = sequence.GetLength();
+        print_timing(name + (sum == n * (n - 1) / 2 ? "" : " MISMATCH"), seconds, n);
+    }
+
+    static void time_where(const std::string& name, Sequence<int>& sequence)
+    {
+        int length = 0;
+        double seconds = measure_seconds([&]()
+            {
+                Sequence<int>* evens = sequence.Where(isEven);
+                length = evens->GetLength();
+                delete evens;
+            });
+        print_timing(name + (length == (sequence.GetLength() + 1) / 2 ? "" : " MISMATCH"), seconds, sequence.GetLength());
+    }
+
+    //         
+    static void bench_indexing(int count)
+    {
+        std::vector<int> items(count);
+        for (int i = 0; i < count; ++i)
+        {
+            items[i] = i;
+        }
+        MLLSequence<int> list(items.data(), count);
+        MArraySequence<int> array(items.data(), count);
+
+        std::cout << "Indexed access, " << count << " elements\n";
+        time_scan("Get(i) scan: MArraySequence", array);
+        time_scan("Get(i) scan: MLLSequence", list);
+        time_where("Where: MArraySequence", array);
+        time_where("Where: MLLSequence", list);
+
+        //     :      
+        const int probes = std::min(count, 1000);
+        long long sum = 0;
+        unsigned state = 1;
+        double seconds = measure_seconds([&]()
+            {
+                for (int k = 0; k < probes; ++k)
+                {
+                    state = state * 1103515245u + 12345u;
+                    sum += list.Get((int)((state >> 8) % (unsigned)count));
+                }
+            });
+        print_timing("random Get(i): MLLSequence" + std::string(sum >= 0 ? "" : " MISMATCH"), seconds, probes);
+        std::cout << "\n";
+    }
+
+    static long long add(long long acc, int x)
+    {
+        return acc + x;
+    }
+
+    static long long triple(int x)
+    {
+        return 3LL * x + 1;
+    }
+
+    //   Sequence     
+    static void bench_algorithms(int count)
+    {
+        std::vector<int> items(count);
+        for (int i = 0; i < count; ++i)
+        {
+            items[i] = i;
+        }
+        MArraySequence<int> array(items.data(), count);
+        MArraySequence<int> arrayCopy(items.data(), count);
+        MLLSequence<int> list(items.data(), count);
+        const long long expected = (long long)count * (count - 1) / 2;
+
+        std::cout << "Sequence algorithms, " << count << " elements\n";
+        long long sum = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    sum = add(sum, items[i]);
+                }
+            });
+        print_timing("sum: raw array loop" + std::string(sum == expected ? "" : " MISMATCH"), seconds, count);
+
+        //           
+        auto addLambda = [](long long acc, int x) { return acc + x; };
+        seconds = measure_seconds([&]() { sum = array.Reduce(add, 0LL); });
+        print_timing("Reduce(function pointer): MArraySequence" + std::string(sum == expected ? "" : " MISMATCH"), seconds, count);
+        seconds = measure_seconds([&]() { sum = array.Reduce(addLambda, 0LL); });
+        print_timing("Reduce(lambda): MArraySequence" + std::string(sum == expected ? "" : " MISMATCH"), seconds, count);
+        seconds = measure_seconds([&]() { sum = list.Reduce(add, 0LL); });
+        print_timing("Reduce(function pointer): MLLSequence" + std::string(sum == expected ? "" : " MISMATCH"), seconds, count);
+        seconds = measure_seconds([&]() { sum = list.Reduce(addLambda, 0LL); });
+        print_timing("Reduce(lambda): MLLSequence" + std::string(sum == expected ? "" : " MISMATCH"), seconds, count);
+
+        bool same = false;
+        seconds = measure_seconds([&]() { same = array == arrayCopy; });
+        print_timing("operator==: MArraySequence" + std::string(same ? "" : " MISMATCH"), seconds, count);
+        seconds = measure_seconds([&]() { same = list == array; });
+        print_timing("operator==: MLLSequence vs array" + std::string(same ? "" : " MISMATCH"), seconds, count);
+
+        int length = 0;
+        seconds = measure_seconds([&]()
+            {
+                MArraySequence<long long> mapped = array.Map<long long, MArraySequence<long long>>(triple);
+                length = mapped.GetLength();
+            });
+        print_timing("Map: MArraySequence" + std::string(length == count ? "" : " MISMATCH"), seconds, count);
+
+        seconds = measure_seconds([&]()
+            {
+                Sequence<int>* part = array.GetSubsequence(count / 4, count - 1);
+                length = part->GetLength();
+                delete part;
+            });
+        print_timing("GetSubsequence: MArraySequence" + std::string(length == count - count / 4 ? "" : " MISMATCH"), seconds, count - count / 4);
+        std::cout << "\n";
+    }
+
+    static int run(int argc, char* argv[])
+    {
+        int count = 100000;
+        if (argc > 2)
+        {
+            count = std::atoi(argv[2]);
+        }
+        bench_indexing(std::max(1, count));
+        bench_algorithms(std::max(1, count));
+        return 0;
+    }
+};
@@ -198,6 +198,137 @@ void test_swap()
     assert(array2[1] == 2);
 }
 
+void test_raw_storage()
+{
+    // Reserved capacity doesn't construct elements
+    {
+        DynamicArray<TrackedObject> array(10);
+        assert(TrackedObject::counter == 0);
+        array.push_back(TrackedObject{});
+        assert(TrackedObject::counter == 1);
+        assert(array.get_capacity() == 10);
+    }
+    assert(TrackedObject::counter == 0);
+
+    // Growth keeps every live element exactly once
+    {
+        DynamicArray<TrackedObject> array;
+        for (int i = 0; i < 33; ++i)
+        {
+            array.push_back(TrackedObject{});
+        }
+        assert(TrackedObject::counter == 33);
+        DynamicArray<TrackedObject> copy(array);
+        assert(TrackedObject::counter == 66);
+    }
+    assert(TrackedObject::counter == 0);
+
+    // Move assignment takes the buffer together with its capacity
+    {
+        DynamicArray<int> array1(16);
+        array1.push_back(1);
+        DynamicArray<int> array2;
+        array2.push_back(2);
+        array2 = std::move(array1);
+        assert(array2.get_capacity() == 16);
+        assert(array2.get_size() == 1);
+        assert(array2[0] == 1);
+        assert(array1.get_capacity() == 0);
+        for (int i = 0; i < 15; ++i)
+        {
+            array2.push_back(i);
+        }
+        assert(array2.get_capacity() == 16);
+    }
+
+    // push_back of an element of the same array while it grows
+    {
+        DynamicArray<std::string> array;
+        array.push_back("first");
+        array.push_back(array[0]);
+        array.push_back(array[1]);
+        assert(array.get_size() == 3);
+        assert(array[2] == "first");
+    }
+}
+
+void test_insert()
+{
+    // Trivially copyable elements (shifted with memmove)
+    {
+        DynamicArray<int> array;
+        for (int i = 0; i < 10; ++i)
+        {
+            array.insert(i, 0);
+        }
+        array.insert(100, 5);
+        array.insert(200, array.get_size());
+        assert(array.get_size() == 12);
+        assert(array[0] == 9);
+        assert(array[5] == 100);
+        assert(array[6] == 4);
+        assert(array[10] == 0);
+        assert(array[11] == 200);
+    }
+
+    // Elements with non-trivial copy
+    {
+        DynamicArray<std::string> array;
+        array.insert("c", 0);
+        array.insert("a", 0);
+        array.insert("b", 1);
+        array.insert(array[0], 3);
+        assert(array.get_size() == 4);
+        assert(array[0] == "a");
+        assert(array[1] == "b");
+        assert(array[2] == "c");
+        assert(array[3] == "a");
+    }
+
+    // The moved-from value lives in the same array and the insert reallocates
+    {
+        DynamicArray<int> array;
+        array.push_back(1);
+        array.push_back(2);
+        array.insert(std::move(array[1]), 0);
+        assert(array.get_size() == 3);
+        assert(array[0] == 2);
+        assert(array[1] == 1);
+        assert(array[2] == 2);
+    }
+
+    {
+        DynamicArray<std::string> array;
+        array.push_back(std::string(100, 'a'));
+        array.push_back(std::string(100, 'b'));
+        array.insert(std::move(array[1]), 0);
+        assert(array.get_size() == 3);
+        assert(array[0] == std::string(100, 'b'));
+        assert(array[1] == std::string(100, 'a'));
+    }
+
+    {
+        DynamicArray<TrackedObject> array;
+        for (int i = 0; i < 5; ++i)
+        {
+            array.insert(TrackedObject{}, 0);
+        }
+        assert(TrackedObject::counter == 5);
+    }
+    assert(TrackedObject::counter == 0);
+
+    try
+    {
+        DynamicArray<int> array;
+        array.insert(1, 1);
+        assert(false);
+    }
+    catch (const std::out_of_range&)
+    {
+        assert(true);
+    }
+}
+
 void run_dynamic_array_tests()
 {
     test_destructor();
@@ -206,6 +337,8 @@ void run_dynamic_array_tests()
     test_accessors();
     test_modifiers();
     test_swap();
+    test_raw_storage();
+    test_insert();
 
     std::cout << "All DynamicArray tests passed successfully!" << std::endl;
 }
\ No newline at end of file
@@ -10,4 +10,6 @@ void test_assignment();
 void test_accessors();
 void test_modifiers();
 void test_swap();
+void test_raw_storage();
+void test_insert();
 void run_dynamic_array_tests();
\ No newline at end of file
@@ -95,28 +95,6 @@ public:
         return list.get_data(index);
     }
 
-    bool operator==(const Sequence<ElementType>& other) const
-    {
-        if (GetLength() != other.GetLength())
-        {
-            return false;
-        }
-
-        for (int i = 0; i < GetLength(); ++i)
-        {
-            if (Get(i) != other.Get(i))
-            {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    bool operator!=(const Sequence<ElementType>& other) const
-    {
-        return !(*this == other);
-    }
-
     LLSequence& operator+=(const Sequence<ElementType>& other)
     {
         if (this == &other)
@@ -124,10 +102,10 @@ public:
             throw std::invalid_argument("Cannot concatenate sequence with itself");
         }
 
-        for (int i = 0; i < other.GetLength(); ++i)
-        {
-            Append(other.Get(i));
-        }
+        other.ForEach([&](const ElementType& item)
+            {
+                Append(item);
+            });
         return *this;
     }
 
@@ -200,20 +178,14 @@ public:
 
 
 
-    template<typename ResultType>
-    ResultType Reduce(ResultType(*reducer)(ResultType, ElementType), ResultType initial) const
+protected:
+    //      start: get_data     , O(1)  
+    void VisitRange(int start, int end, void (*visit)(const ElementType&, void*), void* context) const override
     {
-        if (!reducer)
-        {
-            throw std::invalid_argument("Reducer function cannot be null");
-        }
-
-        ResultType accumulator = initial;
-        for (int i = 0; i < GetLength(); ++i)
+        for (int i = start; i < end; ++i)
         {
-            accumulator = reducer(accumulator, Get(i));
+            visit(list.get_data(i), context);
         }
-        return accumulator;
     }
 
 
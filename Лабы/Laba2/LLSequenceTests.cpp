@@ -1,5 +1,6 @@
 #pragma once
 #include "LLSequenceTests.hpp"
+#include "ASequence.hpp"
 #include "TrackedObject.hpp"
 #include <iostream>
 #include <stdexcept>
@@ -250,6 +251,43 @@ void test_llseq_unzip_operation()
 
 }
 
+void test_llseq_span_algorithms()
+{
+    int items[] = { 1, 2, 3, 4, 5 };
+    MLLSequence<int> list(items, 5);
+    MArraySequence<int> array(items, 5);
+
+    // Lists have no contiguous storage: algorithms walk the nodes
+    assert(list.GetSpan() == nullptr);
+    int sum = 0;
+    list.ForEach(2, 5, [&](const int& x) { sum += x; });
+    assert(sum == 12);
+    assert(list.Reduce<int>([](int acc, int x) { return acc * 10 + x; }, 0) == 12345);
+
+    // Comparisons across list and array in both directions
+    assert(list == array);
+    assert(array == list);
+    array.InsertAt(9, 4);
+    assert(list != array);
+    list.InsertAt(9, 4);
+    assert(list == array);
+
+    // Zip when only one side is contiguous
+    auto zipped = list.Sequence<int>::Zip<int, int, MArraySequence<int>>(&array, [](int a, int b) { return a * b; });
+    assert(zipped.GetLength() == 6);
+    assert(zipped.Get(4) == 81 && zipped.Get(5) == 25);
+
+    auto sub = list.GetSubsequence(3, 5);
+    assert(sub->GetLength() == 3);
+    assert(sub->Get(0) == 4 && sub->Get(1) == 9 && sub->Get(2) == 5);
+    delete sub;
+
+    MLLSequence<int> other(items, 2);
+    list += other;
+    assert(list.GetLength() == 8);
+    assert(list.GetLast() == 2);
+}
+
 void run_llsequence_tests()
 {
     test_llseq_constructors();
@@ -263,6 +301,7 @@ void run_llsequence_tests()
     test_llseq_with_pairs();
     test_llseq_unzip_operation();
     test_llseq_zip_operation();
+    test_llseq_span_algorithms();
 
     std::cout << "All LLSequence tests passed!\n";
 }
\ No newline at end of file
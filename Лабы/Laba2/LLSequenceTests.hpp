@@ -16,4 +16,5 @@ void test_llseq_map_operation();
 void test_llseq_zip_operation();
 void test_llseq_with_pairs();
 void test_llseq_unzip_operation();
+void test_llseq_span_algorithms();
 void run_llsequence_tests();
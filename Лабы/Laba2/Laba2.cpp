@@ -4,8 +4,15 @@
 #include "TLinkedList.hpp"
 #include "LLSequenceTests.hpp"
 #include "ASequenceTests.hpp"
-int main()
+#include "Benchmarks.hpp"
+#include <string>
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+    {
+        return Benchmarks::run(argc, argv);
+    }
+
     run_dynamic_array_tests();
     run_linked_list_tests();
     run_llsequence_tests();
@@ -3,6 +3,19 @@
 #include <algorithm>
 #include <utility>
 
+//    :      
+template<typename Func>
+bool IsNullCallable(const Func&)
+{
+    return false;
+}
+
+template<typename R, typename... Args>
+bool IsNullCallable(R(*func)(Args...))
+{
+    return func == nullptr;
+}
+
 template<typename ElementType>
 class Sequence
 {
@@ -20,6 +33,111 @@ public:
     virtual Sequence<ElementType>* InsertAt(ElementType item, int index) = 0;
     //virtual Sequence<ElementType>* Concat(const Sequence<ElementType>& other) = 0;
 
+    //       GetLength()  nullptr,    .
+    //      
+    virtual const ElementType* GetSpan() const
+    {
+        return nullptr;
+    }
+
+    //   [start, end)  .       
+    //  ,     ,   VisitRange 
+    //      .      
+    template<typename Func>
+    void ForEach(int start, int end, Func func) const
+    {
+        if (start < 0 || end > GetLength() || start > end)
+        {
+            throw std::out_of_range("Invalid range");
+        }
+        if (const ElementType* span = GetSpan())
+        {
+            for (int i = start; i < end; ++i)
+            {
+                func(span[i]);
+            }
+            return;
+        }
+        VisitRange(start, end, [](const ElementType& item, void* context)
+            {
+                (*static_cast<Func*>(context))(item);
+            }, &func);
+    }
+
+    template<typename Func>
+    void ForEach(Func func) const
+    {
+        ForEach(0, GetLength(), func);
+    }
+
+    //    !=;         Get
+    bool SequenceEquals(const Sequence<ElementType>& other) const
+    {
+        const int length = GetLength();
+        if (length != other.GetLength())
+        {
+            return false;
+        }
+        const ElementType* mine = GetSpan();
+        const ElementType* theirs = other.GetSpan();
+        if (mine && theirs)
+        {
+            for (int i = 0; i < length; ++i)
+            {
+                if (mine[i] != theirs[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        //     ,    
+        const Sequence<ElementType>& walked = mine ? other : *this;
+        const Sequence<ElementType>& indexed = mine ? *this : other;
+        bool equal = true;
+        int i = 0;
+        walked.ForEach([&](const ElementType& item)
+            {
+                if (equal && item != indexed.Get(i))
+                {
+                    equal = false;
+                }
+                ++i;
+            });
+        return equal;
+    }
+
+    //     .        
+    //    ,     reducer  
+    template<typename ResultType>
+    ResultType Reduce(ResultType(*reducer)(ResultType, ElementType), ResultType initial) const
+    {
+        if (reducer == nullptr)
+        {
+            throw std::invalid_argument("Reducer function cannot be null");
+        }
+        if (const ElementType* span = GetSpan())
+        {
+            return ReduceSpan(span, GetLength(), reducer, initial);
+        }
+        return ReduceVisited(reducer, initial);
+    }
+
+    //     :     
+    template<typename ResultType, typename Reducer>
+    ResultType Reduce(Reducer reducer, ResultType initial) const
+    {
+        if (IsNullCallable(reducer))
+        {
+            throw std::invalid_argument("Reducer function cannot be null");
+        }
+        if (const ElementType* span = GetSpan())
+        {
+            return ReduceSpan(span, GetLength(), reducer, initial);
+        }
+        return ReduceVisited(reducer, initial);
+    }
+
     template<typename OtherType, typename ResultType, typename ResultSequenceType>
     ResultSequenceType Zip(Sequence<OtherType>* other,
         ResultType(*zipper)(ElementType, OtherType)) const
@@ -35,8 +153,23 @@ public:
         ResultSequenceType result;
 
         const int minLength = std::min(this->GetLength(), other->GetLength());
-        for (int i = 0; i < minLength; ++i) {
-            result.Append(zipper(this->Get(i), other->Get(i)));
+        const ElementType* mine = this->GetSpan();
+        const OtherType* theirs = other->GetSpan();
+        int i = 0;
+        if (theirs) {
+            this->ForEach(0, minLength, [&](const ElementType& item) {
+                result.Append(zipper(item, theirs[i++]));
+            });
+        }
+        else if (mine) {
+            other->ForEach(0, minLength, [&](const OtherType& item) {
+                result.Append(zipper(mine[i++], item));
+            });
+        }
+        else {
+            this->ForEach(0, minLength, [&](const ElementType& item) {
+                result.Append(zipper(item, other->Get(i++)));
+            });
         }
         return result;
     }
@@ -51,11 +184,10 @@ public:
         ResultSequenceType1 firstSeq;
         ResultSequenceType2 secondSeq;
 
-        for (int i = 0; i < zipped->GetLength(); ++i) {
-            auto pair = zipped->Get(i);
+        zipped->ForEach([&](const std::pair<T1, T2>& pair) {
             firstSeq.Append(pair.first);
             secondSeq.Append(pair.second);
-        }
+        });
         //return std::pair<ResultSequenceType1, ResultSequenceType2>(firstSeq, secondSeq);
         return std::make_pair(firstSeq, secondSeq);
     }
@@ -112,14 +244,13 @@ public:
         }
 
         auto result = this->CreateEmpty();
-        for (int i = 0; i < GetLength(); ++i)
-        {
-            ElementType current = Get(i);
-            if (predicate(current))
+        ForEach([&](const ElementType& current)
             {
-                result->Append(current);
-            }
-        }
+                if (predicate(current))
+                {
+                    result->Append(current);
+                }
+            });
         return result;
     }
 
@@ -134,10 +265,10 @@ public:
         auto result = this->CreateEmpty();
 
         //  
-        for (int i = startIndex; i <= endIndex; ++i)
-        {
-            result->Append(Get(i));
-        }
+        ForEach(startIndex, endIndex + 1, [&](const ElementType& item)
+            {
+                result->Append(item);
+            });
 
         return result;
     }
@@ -153,10 +284,10 @@ public:
         Sequence<ElementType>* result = GetThis();
 
         //     
-        for (int i = 0; i < other.GetLength(); ++i)
-        {
-            result->Append(other.Get(i));
-        }
+        other.ForEach([&](const ElementType& item)
+            {
+                result->Append(item);
+            });
 
         return result;
     }
@@ -170,16 +301,61 @@ public:
         }
 
         ResultSequenceType result;
-        for (int i = 0; i < GetLength(); ++i)
-        {
-            result.Append(mapper(Get(i)));
-        }
+        ForEach([&](const ElementType& item)
+            {
+                result.Append(mapper(item));
+            });
         return result;
     }
 
 protected:
+    //    :    
+    template<typename ResultType, typename Reducer>
+    static ResultType ReduceSpan(const ElementType* span, int length, Reducer reducer, ResultType accumulator)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            accumulator = reducer(accumulator, span[i]);
+        }
+        return accumulator;
+    }
+
+    template<typename ResultType, typename Reducer>
+    ResultType ReduceVisited(Reducer reducer, ResultType accumulator) const
+    {
+        ForEach([&](const ElementType& item)
+            {
+                accumulator = reducer(accumulator, item);
+            });
+        return accumulator;
+    }
+
+
+    //     GetSpan:    Get(i), 
+    //      
+    virtual void VisitRange(int start, int end, void (*visit)(const ElementType&, void*), void* context) const
+    {
+        for (int i = start; i < end; ++i)
+        {
+            visit(Get(i), context);
+        }
+    }
 
     virtual Sequence<ElementType>* CreateEmpty()  = 0;
     virtual Sequence<ElementType>* GetThis() = 0;
 
-};
\ No newline at end of file
+};
+
+//          :   ,
+//     . .      C++20    
+template<typename ElementType>
+bool operator==(const Sequence<ElementType>& left, const Sequence<ElementType>& right)
+{
+    return left.SequenceEquals(right);
+}
+
+template<typename ElementType>
+bool operator!=(const Sequence<ElementType>& left, const Sequence<ElementType>& right)
+{
+    return !left.SequenceEquals(right);
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "TLinkedList.hpp"
+#include <vector>
 
 
 void test_destructor1()
@@ -248,6 +249,99 @@ void test_iterators()
     assert(sum == 6);
 }
 
+void test_indexed_access()
+{
+    LinkedList<int> list;
+    std::vector<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i);
+        expected.push_back(i);
+    }
+
+    // Forward and backward scans by index
+    for (size_t i = 0; i < list.get_size(); ++i)
+    {
+        assert(list[i] == expected[i]);
+    }
+    for (size_t i = list.get_size(); i > 0; --i)
+    {
+        assert(list.get_data(i - 1) == expected[i - 1]);
+    }
+
+    // Mixed modifications keep indexed access consistent with a vector
+    unsigned state = 12345;
+    for (int step = 0; step < 3000; ++step)
+    {
+        state = state * 1103515245u + 12345u;
+        size_t position = (state >> 8) % (expected.size() + 1);
+        switch ((state >> 4) % 6)
+        {
+        case 0:
+            list.insert(position, step);
+            expected.insert(expected.begin() + position, step);
+            break;
+        case 1:
+            if (position < expected.size())
+            {
+                list.pop(position);
+                expected.erase(expected.begin() + position);
+            }
+            break;
+        case 2:
+            list.push_front(step);
+            expected.insert(expected.begin(), step);
+            break;
+        case 3:
+            if (!expected.empty())
+            {
+                list.pop_front();
+                expected.erase(expected.begin());
+            }
+            break;
+        case 4:
+            if (!expected.empty())
+            {
+                list.pop_back();
+                expected.pop_back();
+            }
+            break;
+        default:
+            if (position < expected.size())
+            {
+                assert(list[position] == expected[position]);
+            }
+            break;
+        }
+        if (!expected.empty())
+        {
+            size_t probe = (state >> 16) % expected.size();
+            assert(list[probe] == expected[probe]);
+        }
+    }
+
+    assert(list.get_size() == expected.size());
+    size_t i = 0;
+    for (int value : list)
+    {
+        assert(value == expected[i++]);
+    }
+
+    // Copies, moves and swaps don't share the cached position
+    LinkedList<int> copy(list);
+    assert(copy[copy.get_size() / 2] == expected[expected.size() / 2]);
+    LinkedList<int> other;
+    other.push_back(-1);
+    other[0];
+    other.swap(copy);
+    assert(other[expected.size() - 1] == expected.back());
+    assert(copy[0] == -1);
+    LinkedList<int> moved(std::move(other));
+    assert(moved[1] == expected[1]);
+    other.push_back(7);
+    assert(other[0] == 7);
+}
+
 void run_linked_list_tests(void)
 {
     test_destructor1();
@@ -258,6 +352,7 @@ void run_linked_list_tests(void)
     test_concat();
     test_sublist();
     test_iterators();
+    test_indexed_access();
 
     std::cout << "All LinkedList tests passed successfully!" << std::endl;
 }
\ No newline at end of file
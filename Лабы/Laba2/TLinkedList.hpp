@@ -13,4 +13,5 @@ void test_modifiers1();
 void test_concat();
 void test_sublist();
 void test_iterators();
+void test_indexed_access();
 void run_linked_list_tests(void);
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include "Matrix.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+//   (: Laba3 --bench [ ])
+class Benchmarks
+{
+public:
+    template <class Func>
+    static double measure_seconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    static void print_timing(const std::string& name, double seconds, long long count)
+    {
+        std::cout << "  " << std::left << std::setw(44) << name
+            << std::right << std::fixed << std::setprecision(3) << seconds << " s, "
+            << std::setprecision(1) << (seconds > 0 ? count / seconds / 1e6 : 0.0) << " M matrices/s\n";
+    }
+
+    //  ,      
+    template <class MatrixType>
+    static void time_matrices(const std::string& name, long long count, size_t size)
+    {
+        double sum = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (long long i = 0; i < count; ++i)
+                {
+                    MatrixType matrix(size, size);
+                    matrix[size - 1][size - 1] = 1.0;
+                    MatrixType doubled = matrix + matrix;
+                    sum += doubled[size - 1][size - 1];
+                }
+            });
+        print_timing(name + (sum == 2.0 * count ? "" : " MISMATCH"), seconds, count);
+    }
+
+    //       DynamicArray  
+    static void bench_matrices(long long count)
+    {
+        std::cout << "Matrix creation, " << count << " matrices\n";
+        time_matrices<Matrix<double, DynamicArray<double>>>("3x3: DynamicArray rows", count, 3);
+        time_matrices<Matrix<double>>("3x3: SmallDynamicArray<4> rows", count, 3);
+        time_matrices<Matrix<double, DynamicArray<double>>>("4x4: DynamicArray rows", count, 4);
+        time_matrices<Matrix<double>>("4x4: SmallDynamicArray<4> rows", count, 4);
+        time_matrices<Matrix<double, DynamicArray<double>>>("16x16: DynamicArray rows", count / 10, 16);
+        time_matrices<Matrix<double>>("16x16: SmallDynamicArray<4> rows", count / 10, 16);
+        std::cout << "\n";
+    }
+
+    static int run(int argc, char* argv[])
+    {
+        long long count = 1000000LL;
+        if (argc > 2)
+        {
+            count = std::atoll(argv[2]);
+        }
+        bench_matrices(count);
+        return 0;
+    }
+};
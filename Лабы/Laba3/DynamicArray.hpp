@@ -2,6 +2,12 @@
 #include <stdexcept> 
 #include <algorithm>
 #include <utility>
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 template<typename ElementType> //   typename     ,     .        .
 /// <summary>
 ///  void resize(size_t new_capcity)
@@ -17,67 +23,167 @@ template<typename ElementType> //
 class DynamicArray
 {
 private:
+    //    :    size ,
+    //     .     memcpy/memmove,
+    //     realloc (  )
+    static const bool relocatable = std::is_trivially_copyable<ElementType>::value;
+    static_assert(alignof(ElementType) <= alignof(std::max_align_t), "DynamicArray doesn't support over-aligned types");
+
     ElementType* data = nullptr;
     size_t capacity = 0;
     size_t size = 0;
-    //O(n)
+
+    static ElementType* allocate(size_t count)
+    {
+        if (count == 0)
+        {
+            return nullptr;
+        }
+        if (count > SIZE_MAX / sizeof(ElementType))
+        {
+            throw std::bad_alloc();
+        }
+        void* memory = std::malloc(count * sizeof(ElementType));
+        if (memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<ElementType*>(memory);
+    }
+
+    static void destroy(ElementType* first, ElementType* last) noexcept
+    {
+        if (!std::is_trivially_destructible<ElementType>::value)
+        {
+            for (; first != last; ++first)
+            {
+                first->~ElementType();
+            }
+        }
+    }
+
+    //    ;     
+    static void copy_construct(const ElementType* from, size_t count, ElementType* to)
+    {
+        if (relocatable)
+        {
+            if (count > 0)
+            {
+                std::memcpy(static_cast<void*>(to), from, count * sizeof(ElementType));
+            }
+            return;
+        }
+        size_t done = 0;
+        try
+        {
+            for (; done < count; ++done)
+            {
+                new (to + done) ElementType(from[done]);
+            }
+        }
+        catch (...)
+        {
+            destroy(to, to + done);
+            throw;
+        }
+    }
+
+    //O(n),      realloc
     void resize(size_t new_capacity) //  
     {
         if (new_capacity < size)
         {
             throw std::invalid_argument("Capacity can't be < size");
         }
-        ElementType* new_data = new ElementType[new_capacity];
-        for (size_t i = 0; i < size; ++i) {
-            new_data[i] = std::move(data[i]);
+        if (relocatable && new_capacity > 0)
+        {
+            if (new_capacity > SIZE_MAX / sizeof(ElementType))
+            {
+                throw std::bad_alloc();
+            }
+            void* memory = std::realloc(static_cast<void*>(data), new_capacity * sizeof(ElementType));
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            data = static_cast<ElementType*>(memory);
+            capacity = new_capacity;
+            return;
+        }
+        ElementType* new_data = allocate(new_capacity);
+        size_t done = 0;
+        try
+        {
+            for (; done < size; ++done)
+            {
+                new (new_data + done) ElementType(std::move_if_noexcept(data[done]));
+            }
+        }
+        catch (...)
+        {
+            destroy(new_data, new_data + done);
+            std::free(new_data);
+            throw;
         }
-        delete[] data;
+        destroy(data, data + size);
+        std::free(data);
         data = new_data;
         capacity = new_capacity;
     }
 
+    void grow()
+    {
+        resize(capacity == 0 ? 1 : capacity * 2);
+    }
+
 public:
     //
     //
     //O(1)
     explicit /* */ DynamicArray(size_t asumed_capcity = 0 /* */) :capacity(asumed_capcity), size(0)
     {
-        data = new ElementType[capacity];
+        data = allocate(capacity);
     }
     //O(n)
-    DynamicArray(ElementType* items, size_t count) : capacity(count), size(count)
+    DynamicArray(ElementType* items, size_t count) : capacity(count), size(0)
     {
         if (items == nullptr)
         {
             throw std::invalid_argument("Items pointer is null!");
         }
 
-        if (capacity > 0)
+        data = allocate(capacity);
+        try
         {
-            data = new ElementType[capacity];
-            for (size_t i = 0; i < size; ++i)
-            {
-                data[i] = items[i];
-            }
+            copy_construct(items, count, data);
         }
+        catch (...)
+        {
+            std::free(data);
+            throw;
+        }
+        size = count;
     }
 
     // 
     //O(n)
-    DynamicArray(const DynamicArray& other) : capacity(other.capacity), size(other.size)
+    DynamicArray(const DynamicArray& other): capacity(other.capacity), size(0)
     {
-        if (capacity > 0)
+        data = allocate(capacity);
+        try
         {
-            data = new ElementType[capacity];
-            for (size_t i = 0; i < size; ++i)
-            {
-                data[i] = other.data[i];
-            }
+            copy_construct(other.data, other.size, data);
         }
+        catch (...)
+        {
+            std::free(data);
+            throw;
+        }
+        size = other.size;
     }
     // move 
     // O(1)
-    DynamicArray(DynamicArray&& other) noexcept : data(other.data), capacity(other.capacity), size(other.size)
+    DynamicArray(DynamicArray&& other) noexcept: data(other.data), capacity(other.capacity), size(other.size)
     {
         other.data = nullptr;
         other.capacity = 0;
@@ -86,33 +192,23 @@ public:
 
     // 
     // O(n)
-    DynamicArray& operator=(const DynamicArray& array1)
+    DynamicArray& operator=(const DynamicArray&array1) 
     {
         if (this != &array1)
         {
-            DynamicArray temp(array1);
+            DynamicArray temp (array1);
             swap(temp);
         }
         return *this;
     }
-    // O(1) 
-    DynamicArray& operator=(DynamicArray<ElementType>&& other)
+    // O(n)    ;      other 
+    DynamicArray& operator=(DynamicArray<ElementType>&& other) noexcept
     {
-        if (this == &other)
+        if (this != &other)
         {
-            return *this;
-        }
-        if (data)
-        {
-            delete[]data;
+            DynamicArray temp(std::move(other));
+            swap(temp);
         }
-
-        data = other.data;
-        size = other.size;
-
-        other.data = nullptr;
-        other.size = 0;
-
         return *this;
     }
     // O(1)
@@ -124,20 +220,33 @@ public:
     // O(1),    O(n) 
     void push_back(const ElementType& value)
     {
-        if (size >= capacity)
+        if (size >= capacity) 
+        {
+            // value      :     
+            ElementType copy(value);
+            grow();
+            new (data + size) ElementType(std::move(copy));
+        }
+        else
         {
-            resize(capacity == 0 ? 1 : capacity * 2);//   0...
+            new (data + size) ElementType(value);
         }
-        data[size++] = value;
+        ++size;
     }
     // O(1),    O(n) 
     void push_back(ElementType&& value)
     {
         if (size >= capacity)
         {
-            resize(capacity == 0 ? 1 : capacity * 2);
+            ElementType moved(std::move(value));
+            grow();
+            new (data + size) ElementType(std::move(moved));
+        }
+        else
+        {
+            new (data + size) ElementType(std::move(value));
         }
-        data[size++] = std::move(value);
+        ++size;
     }
     // O(1)
     void set(const ElementType& object, size_t index)
@@ -162,11 +271,11 @@ public:
     // O(1)
     ElementType& get(size_t index) const
     {
-        if (index >= size)
+        if (index >= size) 
         {
             throw std::out_of_range("List index out of range");
         }
-        return data[index];
+        return data[index];    
     }
     // O(1)
     void swap(DynamicArray& other) noexcept
@@ -177,57 +286,62 @@ public:
     }
     // O(n)
     size_t get_size() const noexcept
-    {
+    { 
         return size;
     }
     size_t get_capacity() const noexcept
-    {
-        return capacity;
+    { 
+        return capacity; 
     }
-    // O(n)
+// O(n)
     void insert(const ElementType& value, size_t index)
     {
-        if (index > size)
+        if (index > size) 
         {  //      (index == size)
             throw std::out_of_range("Index out of range");
         }
-        //  capacity  
-        if (size >= capacity)
-        {
-            resize(capacity == 0 ? 1 : capacity * 2);
-        }
-
-        //      index
-        for (size_t i = size; i > index; --i)
-        {
-            data[i] = std::move(data[i - 1]);
-        }
-
-        //   
-        data[index] = value;
-        ++size;
+        // value      ,   
+        ElementType copy(value);
+        insert(std::move(copy), index);
     }
 
     //   r-value 
-    void insert(ElementType&& value, size_t index)
+    void insert(ElementType&& value, size_t index) 
     {
         if (index > size)
         {
             throw std::out_of_range("Index out of range");
         }
-
+        // value      :       
+        ElementType moved(std::move(value));
+        //  capacity  
         if (size >= capacity)
         {
-            resize(capacity == 0 ? 1 : capacity * 2);
+            grow();
         }
 
-        for (size_t i = size; i > index; --i)
+        if (relocatable)
         {
-            data[i] = std::move(data[i - 1]);
+            //    memmove,     value
+            std::memmove(static_cast<void*>(data + index + 1), data + index, (size - index) * sizeof(ElementType));
+            new (data + index) ElementType(std::move(moved));
+            ++size;
+            return;
         }
-
-        data[index] = std::move(value);
+        if (index == size)
+        {
+            new (data + size) ElementType(std::move(moved));
+            ++size;
+            return;
+        }
+        //      ,   
+        new (data + size) ElementType(std::move(data[size - 1]));
         ++size;
+        for (size_t i = size - 2; i > index; --i)
+        {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[index] = std::move(moved);
     }
 
     // O(1)
@@ -239,11 +353,13 @@ public:
         }
         ElementType value = std::move(data[size - 1]);
         --size;
+        data[size].~ElementType();
         return value;
     }
 
     ~DynamicArray() /*capacity   size  */
     {
-        delete[] data;
+        destroy(data, data + size);
+        std::free(data);
     }
-};
\ No newline at end of file
+};
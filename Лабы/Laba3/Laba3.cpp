@@ -7,8 +7,16 @@
 #include "DiagonalMatrixTests.hpp"
 #include "SquareMatrixTests.hpp"
 #include "VectorTests.hpp"
-int main()
+#include "SmallDynamicArrayTests.hpp"
+#include "Benchmarks.hpp"
+#include <string>
+int main(int argc, char* argv[])
 {
+	if (argc > 1 && std::string(argv[1]) == "--bench")
+	{
+		return Benchmarks::run(argc, argv);
+	}
+
 	runAllQueueTests();
 	runAllPriorityQueueTests();
 	runAllStackTests();
@@ -17,5 +25,6 @@ int main()
 	MatrixTests::runAllTests();
 	SquareMatrixTests::runAllTests();
 	VectorTests::runAllTests();
+	SmallDynamicArrayTests::runAllTests();
 }
 
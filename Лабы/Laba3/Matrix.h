@@ -1,16 +1,19 @@
 #pragma once
 #include "DynamicArray.hpp"
+#include "SmallDynamicArray.hpp"
 #include <stdexcept>
 #include <cmath>
 #include <complex>
 #include <type_traits>
 
-template<typename T>
+//      4   :   4 
+//      
+template<typename T, typename Row = SmallDynamicArray<T, 4>>
 class Matrix 
 {
 protected:
     size_t rows, cols;
-    DynamicArray<DynamicArray<T>> data;
+    DynamicArray<Row> data;
 
     static double complexNorm(const std::complex<double>& c) 
     {
@@ -23,11 +26,11 @@ protected:
     }
 
 public:
-    Matrix(size_t r, size_t c) : rows(r), cols(c) 
+    Matrix(size_t r, size_t c) : rows(r), cols(c), data(r)
     {
         for (size_t i = 0; i < r; ++i) 
         {
-            DynamicArray<T> row(c); //    
+            Row row(c); //    
             for (size_t j = 0; j < c; ++j)
             {
                 row.push_back(T()); //    
@@ -39,26 +42,26 @@ public:
     size_t getRows() const { return rows; }
     size_t getCols() const { return cols; }
 
-    DynamicArray<T>& operator[](size_t row)
+    Row& operator[](size_t row)
     {
         if (row >= rows) throw std::out_of_range("Row index out of range");
         return data.get(row);
     }
 
-    const DynamicArray<T>& operator[](size_t row) const 
+    const Row& operator[](size_t row) const 
     {
         if (row >= rows) throw std::out_of_range("Row index out of range");
         return data.get(row);
     }
 
-    Matrix<T> operator+(const Matrix<T>& other) const 
+    Matrix operator+(const Matrix& other) const 
     {
         if (rows != other.rows || cols != other.cols)
         {
             throw std::invalid_argument("Matrix dimensions don't match");
         }
 
-        Matrix<T> result(rows, cols);
+        Matrix result(rows, cols);
         for (size_t i = 0; i < rows; ++i) 
         {
             for (size_t j = 0; j < cols; ++j) 
@@ -69,9 +72,9 @@ public:
         return result;
     }
 
-    Matrix<T> operator*(const T& scalar) const
+    Matrix operator*(const T& scalar) const
     {
-        Matrix<T> result(rows, cols);
+        Matrix result(rows, cols);
         for (size_t i = 0; i < rows; ++i)
         {
             for (size_t j = 0; j < cols; ++j)
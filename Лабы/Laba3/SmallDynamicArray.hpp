@@ -0,0 +1,518 @@
+#pragma once
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//    N ;  N = 0        
+template<typename ElementType, size_t N>
+struct SmallArrayBuffer
+{
+    typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type slots[N];
+
+    SmallArrayBuffer() noexcept {}
+
+    ElementType* get() noexcept
+    {
+        return reinterpret_cast<ElementType*>(slots);
+    }
+};
+
+template<typename ElementType>
+struct SmallArrayBuffer<ElementType, 0>
+{
+    ElementType* get() noexcept
+    {
+        return nullptr;
+    }
+};
+
+template<typename ElementType, size_t N>
+/// <summary>
+///      N   :     N,
+///   .   ,   DynamicArray
+/// push_back / insert / remove / pop_back
+/// set / get / operator[]
+/// concat / swap
+/// get_size / get_capacity / get_data / is_inline
+/// </summary>
+class SmallDynamicArray
+{
+private:
+    //   DynamicArray:    size ,   
+    //  memcpy/memmove,       realloc
+    static const bool relocatable = std::is_trivially_copyable<ElementType>::value;
+    static_assert(alignof(ElementType) <= alignof(std::max_align_t), "SmallDynamicArray doesn't support over-aligned types");
+
+    SmallArrayBuffer<ElementType, N> buffer;
+    ElementType* data;
+    size_t capacity;
+    size_t size;
+
+    static void destroy(ElementType* first, ElementType* last) noexcept
+    {
+        if (!std::is_trivially_destructible<ElementType>::value)
+        {
+            for (; first != last; ++first)
+            {
+                first->~ElementType();
+            }
+        }
+    }
+
+    static ElementType* allocate(size_t count)
+    {
+        if (count > SIZE_MAX / sizeof(ElementType))
+        {
+            throw std::bad_alloc();
+        }
+        void* memory = std::malloc(count * sizeof(ElementType));
+        if (memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<ElementType*>(memory);
+    }
+
+    bool on_heap() const noexcept
+    {
+        return capacity > N;
+    }
+
+    //     : ,  new_capacity <= N,   
+    // O(n)
+    void resize(size_t new_capacity)
+    {
+        if (new_capacity < size)
+        {
+            throw std::invalid_argument("Capacity can't be < size");
+        }
+        new_capacity = std::max(new_capacity, N);
+        if (new_capacity == capacity)
+        {
+            return;
+        }
+        if (relocatable && on_heap() && new_capacity > N)
+        {
+            if (new_capacity > SIZE_MAX / sizeof(ElementType))
+            {
+                throw std::bad_alloc();
+            }
+            void* memory = std::realloc(static_cast<void*>(data), new_capacity * sizeof(ElementType));
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            data = static_cast<ElementType*>(memory);
+            capacity = new_capacity;
+            return;
+        }
+
+        ElementType* new_data = new_capacity > N ? allocate(new_capacity) : buffer.get();
+        relocate(data, size, new_data);
+        if (on_heap())
+        {
+            std::free(data);
+        }
+        data = new_data;
+        capacity = new_capacity;
+    }
+
+    //  count     to; from   .
+    //    , to   from  
+    void relocate(ElementType* from, size_t count, ElementType* to)
+    {
+        if (relocatable)
+        {
+            if (count > 0)
+            {
+                std::memcpy(static_cast<void*>(to), from, count * sizeof(ElementType));
+            }
+            return;
+        }
+        size_t done = 0;
+        try
+        {
+            for (; done < count; ++done)
+            {
+                new (to + done) ElementType(std::move_if_noexcept(from[done]));
+            }
+        }
+        catch (...)
+        {
+            destroy(to, to + done);
+            if (to != buffer.get())
+            {
+                std::free(to);
+            }
+            throw;
+        }
+        destroy(from, from + count);
+    }
+
+    void grow(size_t needed)
+    {
+        if (needed > capacity)
+        {
+            resize(std::max(needed, capacity * 2));
+        }
+    }
+
+    //      
+    void release() noexcept
+    {
+        destroy(data, data + size);
+        if (on_heap())
+        {
+            std::free(data);
+        }
+        data = buffer.get();
+        capacity = N;
+        size = 0;
+    }
+
+    //   other; other      
+    void take(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible<ElementType>::value)
+    {
+        if (other.on_heap())
+        {
+            data = other.data;
+            capacity = other.capacity;
+            size = other.size;
+            other.data = other.buffer.get();
+            other.capacity = N;
+            other.size = 0;
+            return;
+        }
+        relocate(other.data, other.size, data);
+        size = other.size;
+        other.size = 0;
+    }
+
+    //  count   ;   
+    void append_copies(const ElementType* items, size_t count)
+    {
+        if (relocatable)
+        {
+            if (count > 0)
+            {
+                std::memcpy(static_cast<void*>(data + size), items, count * sizeof(ElementType));
+            }
+            size += count;
+            return;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            new (data + size) ElementType(items[i]);
+            ++size;
+        }
+    }
+
+public:
+    //
+    //O(1)
+    explicit SmallDynamicArray(size_t assumed_capacity = 0) : data(buffer.get()), capacity(N), size(0)
+    {
+        if (assumed_capacity > N)
+        {
+            data = allocate(assumed_capacity);
+            capacity = assumed_capacity;
+        }
+    }
+    //O(n)
+    SmallDynamicArray(const ElementType* items, size_t count) : SmallDynamicArray(count)
+    {
+        if (items == nullptr && count > 0)
+        {
+            throw std::invalid_argument("Items pointer is null!");
+        }
+        append_copies(items, count);
+    }
+    //O(n)
+    SmallDynamicArray(const SmallDynamicArray& other) : SmallDynamicArray(other.size)
+    {
+        append_copies(other.data, other.size);
+    }
+    // O(1),  other  ; O(n) (n <= N),      
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<ElementType>::value)
+        : data(buffer.get()), capacity(N), size(0)
+    {
+        take(other);
+    }
+
+    ~SmallDynamicArray()
+    {
+        release();
+    }
+
+    // 
+    // O(n)
+    SmallDynamicArray& operator=(const SmallDynamicArray& other)
+    {
+        if (this != &other)
+        {
+            SmallDynamicArray temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+    // O(n)    
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<ElementType>::value)
+    {
+        if (this != &other)
+        {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    // O(1)
+    ElementType& operator[](size_t index)
+    {
+        return get(index);
+    }
+
+    const ElementType& operator[](size_t index) const
+    {
+        return get(index);
+    }
+
+    // O(1)
+    ElementType& get(size_t index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("List index out of range");
+        }
+        return data[index];
+    }
+
+    const ElementType& get(size_t index) const
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("List index out of range");
+        }
+        return data[index];
+    }
+
+    // O(1)
+    void set(const ElementType& object, size_t index)
+    {
+        get(index) = object;
+    }
+
+    void set(ElementType&& object, size_t index)
+    {
+        get(index) = std::move(object);
+    }
+
+    // O(1),    O(n)
+    void push_back(const ElementType& value)
+    {
+        // value      :     
+        if (size >= capacity)
+        {
+            ElementType copy(value);
+            grow(size + 1);
+            new (data + size) ElementType(std::move(copy));
+        }
+        else
+        {
+            new (data + size) ElementType(value);
+        }
+        ++size;
+    }
+
+    void push_back(ElementType&& value)
+    {
+        if (size >= capacity)
+        {
+            ElementType moved(std::move(value));
+            grow(size + 1);
+            new (data + size) ElementType(std::move(moved));
+        }
+        else
+        {
+            new (data + size) ElementType(std::move(value));
+        }
+        ++size;
+    }
+
+    // O(1)
+    ElementType pop_back()
+    {
+        if (size == 0)
+        {
+            throw std::out_of_range("Array is empty");
+        }
+        ElementType value = std::move(data[size - 1]);
+        --size;
+        data[size].~ElementType();
+        return value;
+    }
+
+    // O(n)
+    void insert(const ElementType& value, size_t index)
+    {
+        if (index > size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        ElementType copy(value);
+        insert(std::move(copy), index);
+    }
+
+    void insert(ElementType&& value, size_t index)
+    {
+        if (index > size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        // value      :       
+        ElementType moved(std::move(value));
+        grow(size + 1);
+
+        if (relocatable)
+        {
+            std::memmove(static_cast<void*>(data + index + 1), data + index, (size - index) * sizeof(ElementType));
+            new (data + index) ElementType(std::move(moved));
+            ++size;
+            return;
+        }
+        if (index == size)
+        {
+            new (data + size) ElementType(std::move(moved));
+            ++size;
+            return;
+        }
+        new (data + size) ElementType(std::move(data[size - 1]));
+        ++size;
+        for (size_t i = size - 2; i > index; --i)
+        {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[index] = std::move(moved);
+    }
+
+    // O(n)
+    void remove(size_t index)
+    {
+        if (index >= size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+
+        if (relocatable)
+        {
+            std::memmove(static_cast<void*>(data + index), data + index + 1, (size - index - 1) * sizeof(ElementType));
+            --size;
+            return;
+        }
+        for (size_t i = index; i < size - 1; ++i)
+        {
+            data[i] = std::move(data[i + 1]);
+        }
+        --size;
+        data[size].~ElementType();
+    }
+
+    //   other  
+    // O(n + m)
+    void concat(const SmallDynamicArray& other)
+    {
+        if (this == &other)
+        {
+            SmallDynamicArray copy(other);
+            concat(std::move(copy));
+            return;
+        }
+        grow(size + other.size);
+        append_copies(other.data, other.size);
+    }
+
+    //   r-value:      other,   
+    void concat(SmallDynamicArray&& other)
+    {
+        if (this == &other)
+        {
+            concat(static_cast<const SmallDynamicArray&>(other));
+            return;
+        }
+        if (size == 0)
+        {
+            release();
+            take(other);
+            return;
+        }
+        grow(size + other.size);
+        if (relocatable)
+        {
+            relocate(other.data, other.size, data + size);
+            size += other.size;
+            other.size = 0;
+        }
+        else
+        {
+            for (size_t i = 0; i < other.size; ++i)
+            {
+                new (data + size) ElementType(std::move(other.data[i]));
+                ++size;
+            }
+        }
+        other.release();
+    }
+
+    // O(n) (n <= N)   , O(1),     
+    void swap(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible<ElementType>::value)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+        if (on_heap() && other.on_heap())
+        {
+            std::swap(data, other.data);
+            std::swap(capacity, other.capacity);
+            std::swap(size, other.size);
+            return;
+        }
+        SmallDynamicArray temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    // O(1)
+    size_t get_size() const noexcept
+    {
+        return size;
+    }
+
+    size_t get_capacity() const noexcept
+    {
+        return capacity;
+    }
+
+    ElementType* get_data() noexcept
+    {
+        return data;
+    }
+
+    const ElementType* get_data() const noexcept
+    {
+        return data;
+    }
+
+    //       (  )
+    bool is_inline() const noexcept
+    {
+        return !on_heap();
+    }
+
+};
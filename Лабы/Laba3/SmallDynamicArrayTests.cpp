@@ -0,0 +1,292 @@
+#include "SmallDynamicArrayTests.hpp"
+
+namespace
+{
+    //   :       get_size()
+    struct Counted
+    {
+        static int alive;
+        std::string text;
+
+        Counted(const char* value = "") : text(value) { ++alive; }
+        Counted(const Counted& other) : text(other.text) { ++alive; }
+        Counted(Counted&& other) noexcept : text(std::move(other.text)) { ++alive; }
+        Counted& operator=(const Counted&) = default;
+        Counted& operator=(Counted&&) = default;
+        ~Counted() { --alive; }
+    };
+
+    int Counted::alive = 0;
+}
+
+void SmallDynamicArrayTests::runAllTests()
+{
+    testInlineStorage();
+    testSpillToHeap();
+    testInsertRemove();
+    testCopyMove();
+    testSwap();
+    testConcat();
+    testLifetime();
+    testExceptions();
+    std::cout << "All SmallDynamicArray tests passed successfully!\n";
+}
+
+void SmallDynamicArrayTests::testInlineStorage()
+{
+    SmallDynamicArray<int, 4> array;
+    assert(array.get_size() == 0);
+    assert(array.get_capacity() == 4);
+    assert(array.is_inline());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        array.push_back(i * 10);
+    }
+    assert(array.is_inline());
+    assert(array.get_size() == 4);
+    assert(array[3] == 30);
+
+    //     N   
+    SmallDynamicArray<double, 4> row(3);
+    assert(row.is_inline());
+    assert(row.get_capacity() == 4);
+}
+
+void SmallDynamicArrayTests::testSpillToHeap()
+{
+    SmallDynamicArray<int, 4> array;
+    for (int i = 0; i < 100; ++i)
+    {
+        array.push_back(i);
+    }
+    assert(!array.is_inline());
+    assert(array.get_size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        assert(array.get(i) == i);
+    }
+
+    SmallDynamicArray<int, 4> wide(10);
+    assert(!wide.is_inline());
+    assert(wide.get_capacity() == 10);
+
+    // N = 0:  ,   DynamicArray
+    SmallDynamicArray<std::string, 0> plain;
+    assert(plain.get_capacity() == 0);
+    plain.push_back("a");
+    plain.push_back(plain[0]);
+    assert(plain.get_size() == 2);
+    assert(plain[1] == "a");
+}
+
+void SmallDynamicArrayTests::testInsertRemove()
+{
+    SmallDynamicArray<int, 4> numbers;
+    numbers.insert(3, 0);
+    numbers.insert(1, 0);
+    numbers.insert(2, 1);
+    numbers.insert(4, 3);
+    numbers.insert(0, 0);
+    assert(numbers.get_size() == 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        assert(numbers[i] == i);
+    }
+    numbers.remove(0);
+    numbers.remove(3);
+    assert(numbers.get_size() == 3);
+    assert(numbers[0] == 1 && numbers[1] == 2 && numbers[2] == 3);
+    assert(numbers.pop_back() == 3);
+    assert(numbers.get_size() == 2);
+
+    SmallDynamicArray<std::string, 2> words;
+    words.insert("c", 0);
+    words.insert("a", 0);
+    words.insert("b", 1);
+    words.insert(words[0], 3);
+    assert(words.get_size() == 4);
+    assert(words[0] == "a" && words[1] == "b" && words[2] == "c" && words[3] == "a");
+    words.remove(1);
+    assert(words.get_size() == 3);
+    assert(words[1] == "c");
+    words.set("z", 2);
+    assert(words[2] == "z");
+
+    //       :    
+    SmallDynamicArray<int, 2> aliased;
+    for (int i = 0; i < 4; ++i)
+    {
+        aliased.push_back(i);
+    }
+    aliased.insert(std::move(aliased[3]), 0);
+    aliased.insert(std::move(aliased[1]), 1);
+    assert(aliased.get_size() == 6);
+    assert(aliased[0] == 3 && aliased[1] == 0 && aliased[2] == 0 && aliased[5] == 3);
+
+    SmallDynamicArray<std::string, 2> longWords;
+    longWords.push_back(std::string(100, 'a'));
+    longWords.push_back(std::string(100, 'b'));
+    longWords.insert(std::move(longWords[1]), 0);
+    assert(longWords.get_size() == 3);
+    assert(longWords[0] == std::string(100, 'b') && longWords[1] == std::string(100, 'a'));
+}
+
+void SmallDynamicArrayTests::testCopyMove()
+{
+    SmallDynamicArray<std::string, 4> small;
+    small.push_back("one");
+    small.push_back("two");
+
+    SmallDynamicArray<std::string, 4> copy(small);
+    assert(copy.get_size() == 2 && copy[1] == "two");
+    assert(small.get_size() == 2);
+
+    SmallDynamicArray<std::string, 4> moved(std::move(small));
+    assert(moved.is_inline());
+    assert(moved.get_size() == 2 && moved[0] == "one");
+    assert(small.get_size() == 0);
+
+    SmallDynamicArray<std::string, 4> large;
+    for (int i = 0; i < 10; ++i)
+    {
+        large.push_back(std::to_string(i));
+    }
+    const std::string* buffer = large.get_data();
+    SmallDynamicArray<std::string, 4> stolen(std::move(large));
+    assert(stolen.get_data() == buffer);
+    assert(stolen.get_size() == 10);
+    assert(large.get_size() == 0 && large.is_inline());
+
+    copy = stolen;
+    assert(copy.get_size() == 10 && copy[9] == "9");
+    copy = std::move(moved);
+    assert(copy.get_size() == 2 && copy[1] == "two");
+    assert(moved.get_size() == 0);
+
+    int items[] = { 1, 2, 3, 4, 5 };
+    SmallDynamicArray<int, 4> fromItems(items, 5);
+    assert(fromItems.get_size() == 5 && fromItems[4] == 5);
+}
+
+void SmallDynamicArrayTests::testSwap()
+{
+    SmallDynamicArray<std::string, 2> inlineArray;
+    inlineArray.push_back("x");
+    SmallDynamicArray<std::string, 2> heapArray;
+    for (int i = 0; i < 5; ++i)
+    {
+        heapArray.push_back(std::to_string(i));
+    }
+
+    inlineArray.swap(heapArray);
+    assert(inlineArray.get_size() == 5 && inlineArray[4] == "4");
+    assert(heapArray.get_size() == 1 && heapArray[0] == "x");
+    assert(heapArray.is_inline());
+
+    SmallDynamicArray<std::string, 2> other;
+    other.push_back("y");
+    other.push_back("z");
+    heapArray.swap(other);
+    assert(heapArray.get_size() == 2 && heapArray[1] == "z");
+    assert(other.get_size() == 1 && other[0] == "x");
+}
+
+void SmallDynamicArrayTests::testConcat()
+{
+    SmallDynamicArray<int, 4> first;
+    first.push_back(1);
+    first.push_back(2);
+    SmallDynamicArray<int, 4> second;
+    second.push_back(3);
+    second.push_back(4);
+    second.push_back(5);
+
+    first.concat(second);
+    assert(first.get_size() == 5);
+    assert(second.get_size() == 3);
+    for (int i = 0; i < 5; ++i)
+    {
+        assert(first[i] == i + 1);
+    }
+
+    first.concat(first);
+    assert(first.get_size() == 10);
+    assert(first[9] == 5);
+
+    SmallDynamicArray<std::string, 2> words;
+    words.push_back("a");
+    SmallDynamicArray<std::string, 2> tail;
+    tail.push_back("b");
+    tail.push_back("c");
+    words.concat(std::move(tail));
+    assert(words.get_size() == 3 && words[2] == "c");
+    assert(tail.get_size() == 0);
+
+    SmallDynamicArray<std::string, 2> empty;
+    empty.concat(std::move(words));
+    assert(empty.get_size() == 3 && empty[0] == "a");
+}
+
+void SmallDynamicArrayTests::testLifetime()
+{
+    {
+        SmallDynamicArray<Counted, 4> array(8);
+        assert(Counted::alive == 0);
+        for (int i = 0; i < 12; ++i)
+        {
+            array.push_back(Counted("item"));
+        }
+        assert(Counted::alive == 12);
+        array.insert(Counted("first"), 0);
+        array.remove(5);
+        array.pop_back();
+        assert(Counted::alive == 11);
+        assert(array[0].text == "first");
+
+        SmallDynamicArray<Counted, 4> small;
+        small.push_back(Counted("a"));
+        small.swap(array);
+        assert(Counted::alive == 12);
+        small.concat(array);
+        assert(Counted::alive == 13);
+    }
+    assert(Counted::alive == 0);
+}
+
+void SmallDynamicArrayTests::testExceptions()
+{
+    SmallDynamicArray<int, 2> array;
+    bool thrown = false;
+    try
+    {
+        array.get(0);
+    }
+    catch (const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try
+    {
+        array.pop_back();
+    }
+    catch (const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    thrown = false;
+    try
+    {
+        array.insert(1, 2);
+    }
+    catch (const std::out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+}
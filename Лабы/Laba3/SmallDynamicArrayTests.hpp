@@ -0,0 +1,21 @@
+#pragma once
+#include "SmallDynamicArray.hpp"
+#include <string>
+#include <cassert>
+#include <iostream>
+
+class SmallDynamicArrayTests
+{
+public:
+    static void runAllTests();
+
+private:
+    static void testInlineStorage();
+    static void testSpillToHeap();
+    static void testInsertRemove();
+    static void testCopyMove();
+    static void testSwap();
+    static void testConcat();
+    static void testLifetime();
+    static void testExceptions();
+};
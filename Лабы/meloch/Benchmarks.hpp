@@ -0,0 +1,79 @@
+#pragma once
+#include "NaryTree.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+//   (: meloch --bench [ ])
+class Benchmarks
+{
+public:
+    template <class Func>
+    static double measure_seconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto finish = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    static void print_timing(const std::string& name, double seconds, long long count)
+    {
+        std::cout << "  " << std::left << std::setw(44) << name
+            << std::right << std::fixed << std::setprecision(3) << seconds << " s, "
+            << std::setprecision(1) << (seconds > 0 ? count / seconds / 1e6 : 0.0) << " M nodes/s\n";
+    }
+
+    //  : , arity ,     arity 
+    template <class Tree>
+    static void time_trees(const std::string& name, long long count, size_t arity)
+    {
+        const long long treeSize = 1 + (long long)arity + (long long)(arity * arity);
+        const long long trees = std::max(1LL, count / treeSize);
+        long long found = 0;
+        double seconds = measure_seconds([&]()
+            {
+                for (long long t = 0; t < trees; ++t)
+                {
+                    Tree tree(arity);
+                    tree.insert(0, 0);
+                    for (int child = 1; child <= (int)arity; ++child)
+                    {
+                        tree.insert(0, child);
+                        for (int grandchild = 0; grandchild < (int)arity; ++grandchild)
+                        {
+                            tree.insert(child, child * 100 + grandchild);
+                        }
+                    }
+                    found += tree.contains((int)arity * 100 + (int)arity - 1) ? 1 : 0;
+                }
+            });
+        print_timing(name + (found == trees ? "" : " MISMATCH"), seconds, trees * treeSize);
+    }
+
+    //  :        DynamicArray  
+    static void bench_trees(long long count)
+    {
+        std::cout << "NaryTree construction, " << count << " nodes\n";
+        time_trees<NaryTree<int, DynamicArray>>("arity 2: DynamicArray children", count, 2);
+        time_trees<NaryTree<int>>("arity 2: SmallDynamicArray<4> children", count, 2);
+        time_trees<NaryTree<int, DynamicArray>>("arity 4: DynamicArray children", count, 4);
+        time_trees<NaryTree<int>>("arity 4: SmallDynamicArray<4> children", count, 4);
+        time_trees<NaryTree<int, DynamicArray>>("arity 8: DynamicArray children", count, 8);
+        time_trees<NaryTree<int>>("arity 8: SmallDynamicArray<4> children", count, 8);
+        std::cout << "\n";
+    }
+
+    static int run(int argc, char* argv[])
+    {
+        long long count = 10000000LL;
+        if (argc > 2)
+        {
+            count = std::atoll(argv[2]);
+        }
+        bench_trees(count);
+        return 0;
+    }
+};
@@ -20,6 +20,12 @@ private:
     Node* tail = nullptr;
     size_t size = 0;
 
+    // "":     . get_node     
+    //  head, tail  ,      (Get(i), Get(i + 1), ...)
+    //  O(1)  ,   O(i). -        
+    mutable Node* finger = nullptr;
+    mutable size_t fingerIndex = 0;
+
 public:
     // O(1)
     LinkedList() = default;
@@ -35,11 +41,13 @@ public:
 
     // O(1) 
     //cpy
-    LinkedList(LinkedList&& other) noexcept : head(other.head), tail(other.tail), size(other.size)
+    LinkedList(LinkedList&& other) noexcept : head(other.head), tail(other.tail), size(other.size),
+        finger(other.finger), fingerIndex(other.fingerIndex)
     {
         other.head = nullptr;
         other.tail = nullptr;
         other.size = 0;
+        other.finger = nullptr;
     }
     // O(n)
     LinkedList& operator=(const LinkedList& other) 
@@ -61,9 +69,12 @@ public:
             head = other.head;
             tail = other.tail;
             size = other.size;
+            finger = other.finger;
+            fingerIndex = other.fingerIndex;
             other.head = nullptr;
             other.tail = nullptr;
             other.size = 0;
+            other.finger = nullptr;
         }
         return *this;
     }
@@ -79,32 +90,15 @@ public:
         return *this;
     }
     //      LinkedList
+    // O(1)      ,  O(min(i, n - i, |i - |))
     ElementType& operator[](size_t index) 
     {
-        if (index >= size) 
-        {
-            throw std::out_of_range("Index out of range");
-        }
-        Node* current = head;
-        for (size_t i = 0; i < index; ++i) 
-        {
-            current = current->next;
-        }
-        return current->data;
+        return get_node(index)->data;
     }
 
     const ElementType& operator[](size_t index) const 
     {
-        if (index >= size) 
-        {
-            throw std::out_of_range("Index out of range");
-        }
-        const Node* current = head;
-        for (size_t i = 0; i < index; ++i)
-        {
-            current = current->next;
-        }
-        return current->data;
+        return get_node(index)->data;
     }
 
     // O(1)
@@ -122,6 +116,10 @@ public:
             head = newNode;
         }
         size++;
+        if (finger)
+        {
+            ++fingerIndex;
+        }
     }
 
     // O(1)
@@ -139,6 +137,10 @@ public:
             head = newNode;
         }
         size++;
+        if (finger)
+        {
+            ++fingerIndex;
+        }
     }
 
     // O(1)
@@ -184,6 +186,14 @@ public:
         }
 
         Node* temp = head;
+        if (finger == temp)
+        {
+            finger = nullptr;
+        }
+        else if (finger)
+        {
+            --fingerIndex;
+        }
         head = head->next;
         if (head)
         {
@@ -206,6 +216,10 @@ public:
         }
 
         Node* temp = tail;
+        if (finger == temp)
+        {
+            finger = nullptr;
+        }
         tail = tail->prev;
         if (tail)
         {
@@ -219,7 +233,7 @@ public:
         size--;
     }
 
-    // O(n)
+    // O(1)    ,  O(n)
     void insert(size_t index, const ElementType& value) 
     {
         if (index > size)
@@ -246,10 +260,12 @@ public:
             current->prev = newNode;
 
             size++;
+            //    current (index);      
+            finger = newNode;
         }
     }
 
-    // O(n) 
+    // O(1)    ,  O(n)
     void pop(size_t index)
     {
         if (index >= size)
@@ -270,6 +286,8 @@ public:
             Node* current = get_node(index);
             current->prev->next = current->next;
             current->next->prev = current->prev;
+            //  index   
+            finger = current->next;
             delete current;
             size--;
         }
@@ -290,6 +308,8 @@ public:
         std::swap(head, other.head);
         std::swap(tail, other.tail);
         std::swap(size, other.size);
+        std::swap(finger, other.finger);
+        std::swap(fingerIndex, other.fingerIndex);
     }
 
     // O(1) 
@@ -304,7 +324,7 @@ public:
         return size;
     }
 
-    // O(n) 
+    // O(1)      ,  O(min(i, n - i, |i - |))
     ElementType& get_data(size_t index) const
     {
         return get_node(index)->data;
@@ -358,6 +378,8 @@ public:
             head = other.head;
             tail = other.tail;
             size = other.size;
+            finger = other.finger;
+            fingerIndex = other.fingerIndex;
         }
         else 
         {
@@ -369,6 +391,7 @@ public:
         other.head = nullptr;
         other.tail = nullptr;
         other.size = 0;
+        other.finger = nullptr;
     }
     //O(n)
     LinkedList<ElementType> GetSubList(size_t index1, size_t index2) const
@@ -396,7 +419,8 @@ public:
     }
 
 private:
-    // O(n) 
+    //      : head, tail         
+    // O(min(i, n - i, |i - |)),      O(1)
     Node* get_node(size_t index) const
     {
         if (index >= size)
@@ -405,10 +429,33 @@ private:
         }
 
         Node* current = head;
-        for (size_t i = 0; i < index; ++i)
+        size_t position = 0;
+        size_t distance = index;
+        if (size - 1 - index < distance)
+        {
+            current = tail;
+            position = size - 1;
+            distance = size - 1 - index;
+        }
+        if (finger)
+        {
+            size_t fingerDistance = index > fingerIndex ? index - fingerIndex : fingerIndex - index;
+            if (fingerDistance < distance)
+            {
+                current = finger;
+                position = fingerIndex;
+            }
+        }
+        for (; position < index; ++position)
         {
             current = current->next;
         }
+        for (; position > index; --position)
+        {
+            current = current->prev;
+        }
+        finger = current;
+        fingerIndex = index;
         return current;
     }
 
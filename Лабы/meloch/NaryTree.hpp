@@ -1,17 +1,23 @@
 #pragma once
 #include "DynamicArray.hpp"
+#include "SmallDynamicArray.hpp"
 #include "Queue.hpp"
 #include <iostream>
 #include <stdexcept>
 
-template <typename T>
+//      4    :    4  
+//     
+template <typename U>
+using InlineChildren = SmallDynamicArray<U, 4>;
+
+template <typename T, template <typename> class ChildArray = InlineChildren>
 class NaryTree
 {
 private:
     struct Node
     {
         T data;
-        DynamicArray<Node*> children;
+        ChildArray<Node*> children;
 
         Node(const T& value, size_t arity): data(value), children(arity)
         {
@@ -12,6 +12,7 @@ public:
         testConstructor();
         testInsert();
         testRemove();
+        testChildArrays();
         testEdgeCases();
         testExceptions();
         testPrintOperations();
@@ -95,6 +96,30 @@ private:
         assert(tree.isEmpty());
     }
 
+    static inline void testChildArrays()
+    {
+        //     :     
+        NaryTree<int> tree(4);
+        tree.insert(0, 0);
+        for (int i = 1; i <= 4; ++i)
+        {
+            tree.insert(0, i);
+        }
+        assert(tree.remove(2));
+        assert(!tree.contains(2));
+        assert(tree.contains(1) && tree.contains(3) && tree.contains(4));
+        assert(tree.insert(0, 5));
+
+        //      DynamicArray    
+        NaryTree<int, DynamicArray> plainTree(3);
+        plainTree.insert(1, 1);
+        plainTree.insert(1, 2);
+        plainTree.insert(2, 3);
+        assert(plainTree.contains(3));
+        assert(plainTree.remove(2));
+        assert(!plainTree.contains(3));
+    }
+
     static inline void testEdgeCases()
     {
         // Test large arity
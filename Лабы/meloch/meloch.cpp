@@ -1,7 +1,14 @@
 ﻿#include "SegmentedDequeTests.hpp"
 #include "NaryTreeTests.hpp"
-int main() 
+#include "Benchmarks.hpp"
+#include <string>
+int main(int argc, char* argv[]) 
 {
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+    {
+        return Benchmarks::run(argc, argv);
+    }
+
     SegmentedDequeTests::runAllTests();
     NaryTreeTests::runAllTests();
     return 0;